@@ -0,0 +1,48 @@
+#pragma once
+
+#ifndef XEN_BENCH
+#define XEN_BENCH
+
+#include <chrono>
+#include <cstdio>
+
+#include "core/numdef.hpp"
+
+namespace xen::bench {
+
+/// @details Keeps `val` alive so the measured work can't be optimized out
+template <typename T_>
+inline void keep(const T_& val) noexcept {
+	#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(val) : "memory");
+	#else
+	static volatile const void* sink;
+	sink = &val;
+	#endif /// __GNUC__ || __clang__
+}
+
+/// @returns `val`, hidden from the optimizer so nothing known about its range folds the measured work away
+template <typename T_>
+[[nodiscard]] inline T_ opaque(T_ val) noexcept {
+	#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : "+r"(val));
+	#endif /// __GNUC__ || __clang__
+	return val;
+}
+
+/// @details Runs `fn(i)` for `i` in `[0, iters)` and prints the mean time per call as `group/name`
+template <typename F_>
+inline void run(const char* group, const char* name, u64_t iters, F_&& fn) {
+	for (u64_t i = 0; i < iters / 16; ++i) fn(i); /// warm up
+
+	const auto start = std::chrono::steady_clock::now();
+	for (u64_t i = 0; i < iters; ++i) fn(i);
+	const auto stop = std::chrono::steady_clock::now();
+
+	const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+	std::printf("%-24s %-28s %8.3f ns/op\n", group, name, ns / static_cast<double>(iters));
+}
+
+} /// namespace xen::bench
+
+#endif /// XEN_BENCH
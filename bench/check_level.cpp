@@ -0,0 +1,38 @@
+/// Cost of checking per module, built once per `XEN_CHECK_LEVEL` (see bench/CMakeLists.txt)
+
+#include "bench/bench.hpp"
+#include "core/safe_u64.hpp"
+#include "mem/shared_ref.hpp"
+#include "mem/unique_ref.hpp"
+#include "str/str_slice.hpp"
+
+using namespace xen;
+
+#if XEN_CHECK_LEVEL == XEN_CHECK_FULL
+static constexpr const char* LEVEL = "check_level/full";
+#elif XEN_CHECK_LEVEL == XEN_CHECK_DEBUG
+static constexpr const char* LEVEL = "check_level/debug";
+#else
+static constexpr const char* LEVEL = "check_level/none";
+#endif /// XEN_CHECK_LEVEL
+
+int main() {
+	constexpr u64_t ITERS = 50'000'000;
+
+	safe_u64 acc {1};
+	bench::run(LEVEL, "safe_u64 add", ITERS, [&](u64_t i) { acc += i & 0xFF; bench::keep(acc); });
+	bench::run(LEVEL, "safe_u64 mul", ITERS, [&](u64_t i) { safe_u64 v {i & 0xFFFF}; v *= 3; bench::keep(v); });
+
+	str text {"the quick brown fox jumps over the lazy dog"};
+	const str_slice slice {text};
+	u64_t sum = 0;
+	bench::run(LEVEL, "str operator[]", ITERS, [&](u64_t i) { sum += static_cast<u8_t>(text[i % 43]); bench::keep(sum); });
+	bench::run(LEVEL, "str_slice operator[]", ITERS, [&](u64_t i) { sum += static_cast<u8_t>(slice[i % 43]); bench::keep(sum); });
+
+	unique_ref<u64_t> unique {new u64_t{1}};
+	shared_ref<u64_t> shared {new u64_t{2}};
+	bench::run(LEVEL, "unique_ref operator*", ITERS, [&](u64_t) { sum += *unique; bench::keep(sum); });
+	bench::run(LEVEL, "shared_ref operator*", ITERS, [&](u64_t) { sum += *shared; bench::keep(sum); });
+
+	return 0;
+}
@@ -0,0 +1,94 @@
+/// Cost of the `int_ops` checks behind every `safe_int` operator, built with the `__builtin_*_overflow`
+/// fast path and with `XEN_INT_OPS_PORTABLE` (see bench/CMakeLists.txt), next to the divide based
+/// multiplication check `int_ops` used before
+
+#include "bench/bench.hpp"
+#include "core/int_ops.hpp"
+#include "core/safe_u64.hpp"
+
+using namespace xen;
+
+#ifdef XEN_INT_OPS_PORTABLE
+static constexpr const char* PATH = "int_ops/portable";
+#else
+static constexpr const char* PATH = "int_ops/builtin";
+#endif /// XEN_INT_OPS_PORTABLE
+
+/// @returns `true` if `a * b` doesn't overflow `U64_MAX`, checked with a hardware divide
+[[nodiscard]] static bool old_is_safe_mul(u64_t a, u64_t b) noexcept {
+	if (b == 0) return true;
+	return a <= (U64_MAX / b);
+}
+
+/// @returns `true` if `a + b` doesn't overflow `U64_MAX`, checked with a compare against the room left
+[[nodiscard]] static bool old_is_safe_add(u64_t a, u64_t b) noexcept { return a <= U64_MAX - b; }
+
+/// @returns `true` if `a - b` doesn't go below zero
+[[nodiscard]] static bool old_is_safe_sub(u64_t a, u64_t b) noexcept { return a >= b; }
+
+int main() {
+	constexpr u64_t ITERS = 50'000'000;
+
+	u64_t sum = 0;
+	bench::run(PATH, "add<u64_t>", ITERS, [&](u64_t i) { sum += int_ops::add<u64_t>(sum, i).val; bench::keep(sum); });
+	bench::run(PATH, "sub<u64_t>", ITERS, [&](u64_t i) { sum += int_ops::sub<u64_t>(i | 0xFF, i & 0xFF).val; bench::keep(sum); });
+	bench::run(PATH, "mul<u64_t>", ITERS, [&](u64_t i) { sum += int_ops::mul<u64_t>(i, sum & 0xFFFF).val; bench::keep(sum); });
+	bench::run(PATH, "div<u64_t>", ITERS, [&](u64_t i) { sum += int_ops::div<u64_t>(sum, (i & 0xFF) | 1).val; bench::keep(sum); });
+
+	i64_t acc = 0;
+	bench::run(PATH, "add<i64_t> (i32_t)", ITERS, [&](u64_t i) { acc = int_ops::add<i64_t>(acc, static_cast<i32_t>(i & 0xFF) - 128).val; bench::keep(acc); });
+	bench::run(PATH, "sub<i64_t> (u32_t)", ITERS, [&](u64_t i) { acc = int_ops::sub<i64_t>(acc, static_cast<u32_t>(i & 0xFF)).val; bench::keep(acc); });
+	bench::run(PATH, "mul<i64_t> (i32_t)", ITERS, [&](u64_t i) { acc += int_ops::mul<i64_t>(static_cast<i64_t>(i & 0xFFFF), -3).val; bench::keep(acc); });
+	bench::run(PATH, "div<i64_t> (i32_t)", ITERS, [&](u64_t i) { acc += int_ops::div<i64_t>(acc, -static_cast<i32_t>((i & 0xFF) | 1)).val; bench::keep(acc); });
+
+	/// old versus new checks on in range operands (the fast path), the operand ranges hidden & results kept so no check folds away
+	u64_t ok = 0;
+	bench::run(PATH, "add check (int_ops)", ITERS, [&](u64_t i) {
+		const int_step<u64_t> step = int_ops::add<u64_t>(i, bench::opaque(ok & 0xFFFF));
+		ok += step.ok + (step.val & 1);
+		bench::keep(ok);
+	});
+	bench::run(PATH, "add check (old compare)", ITERS, [&](u64_t i) {
+		const u64_t b = bench::opaque(ok & 0xFFFF);
+		ok += old_is_safe_add(i, b) + ((i + b) & 1);
+		bench::keep(ok);
+	});
+	bench::run(PATH, "sub check (int_ops)", ITERS, [&](u64_t i) {
+		const int_step<u64_t> step = int_ops::sub<u64_t>(i | 0x10000, bench::opaque(ok & 0xFFFF));
+		ok += step.ok + (step.val & 1);
+		bench::keep(ok);
+	});
+	bench::run(PATH, "sub check (old compare)", ITERS, [&](u64_t i) {
+		const u64_t a = i | 0x10000, b = bench::opaque(ok & 0xFFFF);
+		ok += old_is_safe_sub(a, b) + ((a - b) & 1);
+		bench::keep(ok);
+	});
+	bench::run(PATH, "mul check (int_ops)", ITERS, [&](u64_t i) {
+		const int_step<u64_t> step = int_ops::mul<u64_t>(i & 0xFFFF, bench::opaque((ok & 0xFFFF) | 1));
+		ok += step.ok + (step.val & 1);
+		bench::keep(ok);
+	});
+	bench::run(PATH, "mul check (old divide)", ITERS, [&](u64_t i) {
+		const u64_t a = i & 0xFFFF, b = bench::opaque((ok & 0xFFFF) | 1);
+		ok += old_is_safe_mul(a, b) + ((a * b) & 1);
+		bench::keep(ok);
+	});
+
+	/// the failure path: every multiplication overflows
+	bench::run(PATH, "mul overflow (int_ops)", ITERS, [&](u64_t i) {
+		ok += int_ops::mul<u64_t>(i | (u64_t{1} << 40), bench::opaque((ok & 0xFFFF) | (u64_t{1} << 32))).ok;
+		bench::keep(ok);
+	});
+	bench::run(PATH, "mul overflow (old divide)", ITERS, [&](u64_t i) {
+		ok += old_is_safe_mul(i | (u64_t{1} << 40), bench::opaque((ok & 0xFFFF) | (u64_t{1} << 32)));
+		bench::keep(ok);
+	});
+
+	safe_u64 val {1};
+	bench::run(PATH, "safe_u64 operator+=", ITERS, [&](u64_t i) { val += i & 0xFF; bench::keep(val); });
+	bench::run(PATH, "safe_u64 operator-=", ITERS, [&](u64_t i) { val += 0x100; val -= i & 0xFF; bench::keep(val); });
+	bench::run(PATH, "safe_u64 operator*=", ITERS, [&](u64_t i) { safe_u64 v {i & 0xFFFF}; v *= 3; bench::keep(v); });
+	bench::run(PATH, "safe_u64 operator/=", ITERS, [&](u64_t i) { safe_u64 v {i}; v /= (i & 0xFF) | 1; bench::keep(v); });
+
+	return 0;
+}
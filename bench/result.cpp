@@ -0,0 +1,53 @@
+/// Failure heavy workloads: `safe_u64` throwing & catching versus `checked_*` returning a `result`
+
+#include "bench/bench.hpp"
+#include "core/checked.hpp"
+#include "core/safe_u64.hpp"
+#include "str/parse.hpp"
+
+using namespace xen;
+
+static constexpr const char* GROUP = "result";
+
+/// @returns An operand which overflows `1 +` for `fail_pct` % of `i`
+[[nodiscard]] static u64_t operand(u64_t i, u64_t fail_pct) noexcept { return i % 100 < fail_pct ? U64_MAX : i & 0xFF; }
+
+int main() {
+	constexpr u64_t ITERS = 2'000'000;
+	static_assert(XEN_CHECK_LEVEL == XEN_CHECK_FULL, "`safe_u64` must throw to compare against `result`");
+
+	for (const u64_t fail_pct : {u64_t{0}, u64_t{10}, u64_t{90}}) {
+		char throw_name[32], result_name[32];
+		std::snprintf(throw_name, sizeof(throw_name), "throw+catch (%llu%% fail)", fail_pct);
+		std::snprintf(result_name, sizeof(result_name), "checked_add (%llu%% fail)", fail_pct);
+
+		u64_t fails = 0;
+		bench::run(GROUP, throw_name, ITERS, [&](u64_t i) {
+			try {
+				safe_u64 val {1};
+				val += operand(i, fail_pct);
+				bench::keep(val);
+			} catch (err) {
+				++fails;
+			}
+		});
+
+		bench::run(GROUP, result_name, ITERS, [&](u64_t i) {
+			const result<safe_u64> res = checked_add(safe_u64{1}, operand(i, fail_pct));
+			fails += res.is_err();
+			bench::keep(res);
+		});
+
+		bench::keep(fails);
+	}
+
+	/// mostly malformed input, errors only ever returned
+	const str_slice INPUTS[] {"12", "x1", "99999999999999999999", "", "-3", "0x", "1 ", "7a"};
+	u64_t parsed = 0;
+	bench::run(GROUP, "parse_int (75% fail)", ITERS, [&](u64_t i) {
+		parsed += parse_int<u64_t>(INPUTS[i & 7]).get_or(0);
+		bench::keep(parsed);
+	});
+
+	return 0;
+}
@@ -0,0 +1,39 @@
+/// Throughput of `safe_u128` / `safe_u256` operators, next to unchecked `unsigned __int128`
+
+#include "bench/bench.hpp"
+#include "core/safe_uint.hpp"
+
+using namespace xen;
+
+static constexpr const char* GROUP = "safe_uint";
+
+int main() {
+	constexpr u64_t ITERS = 20'000'000;
+
+	unsigned __int128 raw = 1;
+	bench::run(GROUP, "__int128 add (unchecked)", ITERS, [&](u64_t i) { raw += i; bench::keep(raw); });
+	bench::run(GROUP, "__int128 mul (unchecked)", ITERS, [&](u64_t i) { raw = (raw & U64_MAX) * (i | 1); bench::keep(raw); });
+	bench::run(GROUP, "__int128 div (unchecked)", ITERS, [&](u64_t i) { raw = (raw | 1) / ((i & 0xFFFF) | 1); bench::keep(raw); });
+
+	safe_u128 a {1};
+	bench::run(GROUP, "safe_u128 +=", ITERS, [&](u64_t i) { a += i; bench::keep(a); });
+	bench::run(GROUP, "safe_u128 -=", ITERS, [&](u64_t i) { a += U64_MAX; a -= i; bench::keep(a); });
+	bench::run(GROUP, "safe_u128 *", ITERS, [&](u64_t i) { bench::keep(safe_u128{a.get_limb(0)} * safe_u128{i | 1}); });
+	bench::run(GROUP, "safe_u128 / (1 limb)", ITERS, [&](u64_t i) { bench::keep(a / safe_u128{(i & 0xFFFF) | 1}); });
+	bench::run(GROUP, "safe_u128 / (2 limbs)", ITERS / 10, [&](u64_t i) {
+		bench::keep(safe_u128::max() / safe_u128::from_limbs({i, 1}));
+	});
+
+	safe_u256 b {1};
+	bench::run(GROUP, "safe_u256 +=", ITERS, [&](u64_t i) { b += i; bench::keep(b); });
+	bench::run(GROUP, "safe_u256 -=", ITERS, [&](u64_t i) { b += U64_MAX; b -= i; bench::keep(b); });
+	bench::run(GROUP, "safe_u256 *", ITERS, [&](u64_t i) {
+		bench::keep(safe_u256::from_limbs({i, i, 0, 0}) * safe_u256::from_limbs({i | 1, 1, 0, 0}));
+	});
+	bench::run(GROUP, "safe_u256 / (1 limb)", ITERS, [&](u64_t i) { bench::keep(safe_u256::max() / safe_u256{(i & 0xFFFF) | 1}); });
+	bench::run(GROUP, "safe_u256 / (3 limbs)", ITERS / 100, [&](u64_t i) {
+		bench::keep(safe_u256::max() / safe_u256::from_limbs({i, i, 1, 0}));
+	});
+
+	return 0;
+}
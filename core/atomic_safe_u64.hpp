@@ -0,0 +1,158 @@
+#pragma once
+
+#ifndef XEN_ATOMIC_SAFE_U64
+#define XEN_ATOMIC_SAFE_U64
+
+#include <atomic>
+#include <type_traits>
+
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+
+namespace xen {
+
+/// @class `atomic_safe_u64`
+/// @brief A lock-free `safe_u64` which can be shared between threads.
+/// @section Features:
+/// - Same size as `std::atomic<u64_t>`, lock-free wherever it is.
+/// - `fetch_add` / `fetch_sub` / `fetch_mul` run a compare-and-swap loop (a load and one `lock cmpxchg`
+///   when uncontended), only a checked result is ever stored, so no thread can observe or build on a wrapped value.
+/// - Every operation takes a `std::memory_order`, defaulting to `seq_cst` like `std::atomic`.
+/// - Failures throw at every `XEN_CHECK_LEVEL`, the value is left as it was before the operation:
+/// --> `err::NumOverflow`  : Operation result exceeds maximum `u64_t` capacity.
+/// --> `err::NumUnderflow` : Operation result goes below zero (not representable by `u64_t`).
+class atomic_safe_u64 {
+private:
+	std::atomic<u64_t> _val {0};
+
+#pragma region /// Helpers
+
+	/// @returns `val` as `u64_t`, `neg` is set if it was a negative signed integer
+	template <typename R_>
+		requires int_operand<R_>
+	[[nodiscard]] static constexpr u64_t _magnitude(R_ val, bool& neg) noexcept {
+		const auto raw = raw_int(val);
+		if constexpr (std::is_signed_v<decltype(raw)>) {
+			neg = raw < 0;
+			return neg ? u64_t{0} - static_cast<u64_t>(raw) : static_cast<u64_t>(raw);
+		} else {
+			neg = false;
+			return static_cast<u64_t>(raw);
+		}
+	}
+
+	/// @returns The value before applying `op(old)` (an `int_step<u64_t>`), throws its failure instead
+	/// @details A compare-and-swap loop, the value is only ever replaced by a checked result
+	template <typename F_>
+	u64_t _update(F_&& op, std::memory_order order) {
+		u64_t old = _val.load(std::memory_order_relaxed);
+
+		for (;;) {
+			const int_step<u64_t> step = op(old);
+			if (!step.ok) [[unlikely]] throw step.fail;
+
+			if (_val.compare_exchange_weak(old, step.val, order, std::memory_order_relaxed)) return old;
+		}
+	}
+
+	/// @returns The value before adding `val`, throws `err::NumOverflow` if it wouldn't fit
+	u64_t _add(u64_t val, std::memory_order order) {
+		return _update([val](u64_t old) { return int_ops::add<u64_t>(old, val); }, order);
+	}
+
+	/// @returns The value before subtracting `val`, throws `err::NumUnderflow` if it would go below zero
+	u64_t _sub(u64_t val, std::memory_order order) {
+		return _update([val](u64_t old) { return int_ops::sub<u64_t>(old, val); }, order);
+	}
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Constructors
+
+	[[nodiscard]] constexpr atomic_safe_u64() noexcept = default;
+
+	[[nodiscard]] constexpr atomic_safe_u64(safe_u64 val) noexcept : _val{val.get()} {}
+
+	atomic_safe_u64(const atomic_safe_u64&) = delete;
+	atomic_safe_u64& operator=(const atomic_safe_u64&) = delete;
+
+#pragma endregion /// Constructors
+#pragma region /// Load & Store
+
+	/// @returns The current value
+	[[nodiscard]] safe_u64 load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+		return _val.load(order);
+	}
+
+	/// @details Replaces the current value with `val`
+	void store(safe_u64 val, std::memory_order order = std::memory_order_seq_cst) noexcept {
+		_val.store(val.get(), order);
+	}
+
+	/// @returns The value before being replaced with `val`
+	safe_u64 exchange(safe_u64 val, std::memory_order order = std::memory_order_seq_cst) noexcept {
+		return _val.exchange(val.get(), order);
+	}
+
+	[[nodiscard]] operator safe_u64() const noexcept { return load(); }
+
+#pragma endregion /// Load & Store
+#pragma region /// Operations
+
+	/// @returns The value before adding `val`
+	/// @note A negative `val` is subtracted
+	template <typename R_>
+		requires int_operand<R_>
+	safe_u64 fetch_add(R_ val, std::memory_order order = std::memory_order_seq_cst) {
+		bool neg;
+		const u64_t mag = _magnitude(val, neg);
+		return neg ? _sub(mag, order) : _add(mag, order);
+	}
+
+	/// @returns The value before subtracting `val`
+	/// @note A negative `val` is added
+	template <typename R_>
+		requires int_operand<R_>
+	safe_u64 fetch_sub(R_ val, std::memory_order order = std::memory_order_seq_cst) {
+		bool neg;
+		const u64_t mag = _magnitude(val, neg);
+		return neg ? _add(mag, order) : _sub(mag, order);
+	}
+
+	/// @returns The value before multiplying by `val`
+	/// @note Multiplying by a negative `val` throws `err::NumUnderflow` unless the value is `0`
+	template <typename R_>
+		requires int_operand<R_>
+	safe_u64 fetch_mul(R_ val, std::memory_order order = std::memory_order_seq_cst) {
+		return _update([val](u64_t old) { return int_ops::mul<u64_t>(old, raw_int(val)); }, order);
+	}
+
+	safe_u64 operator++() { return fetch_add(1) + 1; }
+	safe_u64 operator--() { return fetch_sub(1) - 1; }
+
+	safe_u64 operator++(int) { return fetch_add(1); }
+	safe_u64 operator--(int) { return fetch_sub(1); }
+
+	template <typename R_>
+		requires int_operand<R_>
+	safe_u64 operator+=(R_ val) { return fetch_add(val) + val; }
+
+	template <typename R_>
+		requires int_operand<R_>
+	safe_u64 operator-=(R_ val) { return fetch_sub(val) - val; }
+
+	template <typename R_>
+		requires int_operand<R_>
+	safe_u64 operator*=(R_ val) { return fetch_mul(val) * val; }
+
+#pragma endregion /// Operations
+};
+
+static_assert(sizeof(atomic_safe_u64) == sizeof(u64_t));
+
+} /// namespace xen
+
+#endif /// XEN_ATOMIC_SAFE_U64
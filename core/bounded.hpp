@@ -0,0 +1,186 @@
+#pragma once
+
+#ifndef XEN_BOUNDED
+#define XEN_BOUNDED
+
+#include <compare>
+#include <type_traits>
+#include <utility>
+
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "err/err.hpp"
+
+namespace xen {
+
+/// @namespace `_bounded`
+/// @details Compile-time range arithmetic of `bounded`
+namespace _bounded {
+
+/// @details Range of a result, clamped into `i64_t`. `exact` is unset if it had to be clamped.
+struct range {
+	i64_t min;
+	i64_t max;
+	bool exact;
+};
+
+/// @returns `step` value, or the `i64_t` limit it went past
+[[nodiscard]] constexpr i64_t _clamp(const int_step<i64_t>& step) noexcept { return step.ok ? step.val : step.bound; }
+
+[[nodiscard]] constexpr range add(i64_t a_min, i64_t a_max, i64_t b_min, i64_t b_max) noexcept {
+	const int_step<i64_t> lo = int_ops::add<i64_t>(a_min, b_min);
+	const int_step<i64_t> hi = int_ops::add<i64_t>(a_max, b_max);
+	return range{_clamp(lo), _clamp(hi), lo.ok && hi.ok};
+}
+
+[[nodiscard]] constexpr range sub(i64_t a_min, i64_t a_max, i64_t b_min, i64_t b_max) noexcept {
+	const int_step<i64_t> lo = int_ops::sub<i64_t>(a_min, b_max);
+	const int_step<i64_t> hi = int_ops::sub<i64_t>(a_max, b_min);
+	return range{_clamp(lo), _clamp(hi), lo.ok && hi.ok};
+}
+
+/// @details The extremes of a product are always among the products of the operand bounds
+[[nodiscard]] constexpr range mul(i64_t a_min, i64_t a_max, i64_t b_min, i64_t b_max) noexcept {
+	const int_step<i64_t> corners[4] {
+		int_ops::mul<i64_t>(a_min, b_min), int_ops::mul<i64_t>(a_min, b_max),
+		int_ops::mul<i64_t>(a_max, b_min), int_ops::mul<i64_t>(a_max, b_max),
+	};
+
+	range res {_clamp(corners[0]), _clamp(corners[0]), true};
+	for (const int_step<i64_t>& corner : corners) {
+		const i64_t val = _clamp(corner);
+		if (val < res.min) res.min = val;
+		if (val > res.max) res.max = val;
+		res.exact &= corner.ok;
+	}
+
+	return res;
+}
+
+/// @details Smallest integer type holding every value of `[MIN_, MAX_]`
+template <i64_t MIN_, i64_t MAX_>
+using storage_t = std::conditional_t<(MIN_ >= 0),
+	std::conditional_t<(MAX_ <= U8_MAX), u8_t,
+	std::conditional_t<(MAX_ <= U16_MAX), u16_t,
+	std::conditional_t<(MAX_ <= U32_MAX), u32_t, u64_t>>>,
+	std::conditional_t<(MIN_ >= I8_MIN && MAX_ <= I8_MAX), i8_t,
+	std::conditional_t<(MIN_ >= I16_MIN && MAX_ <= I16_MAX), i16_t,
+	std::conditional_t<(MIN_ >= I32_MIN && MAX_ <= I32_MAX), i32_t, i64_t>>>>;
+
+/// @details Tag of the unchecked `bounded` constructor, for values already proven in range
+struct unchecked_t {};
+
+} /// namespace _bounded
+
+/// @class `bounded`
+/// @brief An integer carrying its value range `[MIN_, MAX_]` in its type.
+/// @section Features:
+/// - Stored in the smallest integer type holding the range (`bounded<0, 99>` is one byte).
+/// - Arithmetic (+, -, *) between `bounded` values yields a `bounded` of the widened range,
+///   computed at compile time, so `i * stride + off` needs no runtime check at all.
+/// - A runtime check (and `noexcept(false)`) is only emitted once a result range leaves `i64_t`:
+/// --> `err::NumOverflow`  : Operation result exceeds maximum `i64_t` capacity.
+/// --> `err::NumUnderflow` : Operation result goes below minimum `i64_t` capacity.
+/// - Constructing from a raw integer or a wider `bounded` is explicit and checked, same `err`s
+///   for values past `MAX_` / below `MIN_`. Narrower `bounded` values convert implicitly for free.
+/// - Can be compared with any other `bounded`.
+/// @note Raw integers don't carry a range, wrap constants as `bounded_c<V>`
+template <i64_t MIN_, i64_t MAX_>
+	requires (MIN_ <= MAX_)
+class bounded {
+public:
+	typedef _bounded::storage_t<MIN_, MAX_> value_type;
+
+	static constexpr i64_t MIN = MIN_;
+	static constexpr i64_t MAX = MAX_;
+
+private:
+	value_type _val {static_cast<value_type>(MIN_ > 0 ? MIN_ : (MAX_ < 0 ? MAX_ : 0))};
+
+	/// @returns `val` if in range, throws otherwise
+	template <typename R_>
+	[[nodiscard]] static constexpr value_type _check(R_ val) {
+		if (std::cmp_greater(val, MAX_)) [[unlikely]] throw err::NumOverflow;
+		if (std::cmp_less(val, MIN_)) [[unlikely]] throw err::NumUnderflow;
+		return static_cast<value_type>(val);
+	}
+
+	/// @returns `bounded` of range `R_` holding `step`, throws if a clamped range was exceeded
+	template <_bounded::range R_>
+	[[nodiscard]] static constexpr bounded<R_.min, R_.max> _make(const int_step<i64_t>& step) noexcept(R_.exact) {
+		if constexpr (!R_.exact) {
+			if (!step.ok) [[unlikely]] throw step.fail;
+		}
+
+		return bounded<R_.min, R_.max>{_bounded::unchecked_t{}, step.val};
+	}
+
+public:
+#pragma region /// Constructors
+
+	/// @details Holds the value of `[MIN_, MAX_]` closest to zero
+	[[nodiscard]] constexpr bounded() noexcept = default;
+
+	template <typename R_>
+		requires std::is_integral_v<R_>
+	[[nodiscard]] constexpr explicit bounded(R_ val) : _val{_check(val)} {}
+
+	/// @warning Unchecked, `val` must already be within `[MIN_, MAX_]`
+	[[nodiscard]] constexpr bounded(_bounded::unchecked_t, i64_t val) noexcept : _val{static_cast<value_type>(val)} {}
+
+	template <i64_t M_, i64_t X_>
+	[[nodiscard]] constexpr explicit(M_ < MIN_ || X_ > MAX_) bounded(bounded<M_, X_> val) noexcept(M_ >= MIN_ && X_ <= MAX_)
+	: _val{M_ >= MIN_ && X_ <= MAX_ ? static_cast<value_type>(val.get()) : _check(val.get())} {}
+
+	/// @returns The wrapped integer
+	[[nodiscard]] constexpr value_type get() const noexcept { return _val; }
+
+	[[nodiscard]] constexpr explicit operator value_type() const noexcept { return _val; }
+
+#pragma endregion /// Constructors
+#pragma region /// Operations
+
+	template <i64_t M_, i64_t X_>
+	friend constexpr auto operator+(bounded lhs, bounded<M_, X_> rhs) noexcept(_bounded::add(MIN_, MAX_, M_, X_).exact) {
+		constexpr _bounded::range RANGE = _bounded::add(MIN_, MAX_, M_, X_);
+		if constexpr (RANGE.exact) return bounded<RANGE.min, RANGE.max>{_bounded::unchecked_t{}, static_cast<i64_t>(lhs._val) + static_cast<i64_t>(rhs.get())};
+		else return _make<RANGE>(int_ops::add<i64_t>(lhs._val, rhs.get()));
+	}
+
+	template <i64_t M_, i64_t X_>
+	friend constexpr auto operator-(bounded lhs, bounded<M_, X_> rhs) noexcept(_bounded::sub(MIN_, MAX_, M_, X_).exact) {
+		constexpr _bounded::range RANGE = _bounded::sub(MIN_, MAX_, M_, X_);
+		if constexpr (RANGE.exact) return bounded<RANGE.min, RANGE.max>{_bounded::unchecked_t{}, static_cast<i64_t>(lhs._val) - static_cast<i64_t>(rhs.get())};
+		else return _make<RANGE>(int_ops::sub<i64_t>(lhs._val, rhs.get()));
+	}
+
+	template <i64_t M_, i64_t X_>
+	friend constexpr auto operator*(bounded lhs, bounded<M_, X_> rhs) noexcept(_bounded::mul(MIN_, MAX_, M_, X_).exact) {
+		constexpr _bounded::range RANGE = _bounded::mul(MIN_, MAX_, M_, X_);
+		if constexpr (RANGE.exact) return bounded<RANGE.min, RANGE.max>{_bounded::unchecked_t{}, static_cast<i64_t>(lhs._val) * static_cast<i64_t>(rhs.get())};
+		else return _make<RANGE>(int_ops::mul<i64_t>(lhs._val, rhs.get()));
+	}
+
+#pragma endregion /// Operations
+#pragma region /// Comparison overload
+
+	template <i64_t M_, i64_t X_>
+	friend constexpr bool operator==(bounded lhs, bounded<M_, X_> rhs) noexcept { return std::cmp_equal(lhs._val, rhs.get()); }
+
+	template <i64_t M_, i64_t X_>
+	friend constexpr std::strong_ordering operator<=>(bounded lhs, bounded<M_, X_> rhs) noexcept {
+		if (std::cmp_less(lhs._val, rhs.get())) return std::strong_ordering::less;
+		if (std::cmp_greater(lhs._val, rhs.get())) return std::strong_ordering::greater;
+		return std::strong_ordering::equal;
+	}
+
+#pragma endregion /// Comparison overload
+};
+
+/// @details Compile-time constant `V_` as a `bounded`
+template <i64_t V_>
+inline constexpr bounded<V_, V_> bounded_c {V_};
+
+} /// namespace xen
+
+#endif /// XEN_BOUNDED
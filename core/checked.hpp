@@ -0,0 +1,162 @@
+#pragma once
+
+#ifndef XEN_CHECKED
+#define XEN_CHECKED
+
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_int.hpp"
+#include "err/err.hpp"
+#include "err/result.hpp"
+
+namespace xen {
+
+#pragma region /// Checked operations
+
+/// @returns `lhs + rhs`, or the `err` it failed with. Never throws.
+template <typename T_, typename P_, typename R_>
+	requires int_operand<R_>
+[[nodiscard]] constexpr result<safe_int<T_, P_>> checked_add(safe_int<T_, P_> lhs, R_ rhs) noexcept {
+	const int_step<T_> step = int_ops::add<T_>(lhs.get(), raw_int(rhs));
+	if (!step.ok) [[unlikely]] return step.fail;
+	return safe_int<T_, P_>{step.val};
+}
+
+/// @returns `lhs - rhs`, or the `err` it failed with. Never throws.
+template <typename T_, typename P_, typename R_>
+	requires int_operand<R_>
+[[nodiscard]] constexpr result<safe_int<T_, P_>> checked_sub(safe_int<T_, P_> lhs, R_ rhs) noexcept {
+	const int_step<T_> step = int_ops::sub<T_>(lhs.get(), raw_int(rhs));
+	if (!step.ok) [[unlikely]] return step.fail;
+	return safe_int<T_, P_>{step.val};
+}
+
+/// @returns `lhs * rhs`, or the `err` it failed with. Never throws.
+template <typename T_, typename P_, typename R_>
+	requires int_operand<R_>
+[[nodiscard]] constexpr result<safe_int<T_, P_>> checked_mul(safe_int<T_, P_> lhs, R_ rhs) noexcept {
+	const int_step<T_> step = int_ops::mul<T_>(lhs.get(), raw_int(rhs));
+	if (!step.ok) [[unlikely]] return step.fail;
+	return safe_int<T_, P_>{step.val};
+}
+
+/// @returns `lhs / rhs`, or the `err` it failed with. Never throws.
+template <typename T_, typename P_, typename R_>
+	requires int_operand<R_>
+[[nodiscard]] constexpr result<safe_int<T_, P_>> checked_div(safe_int<T_, P_> lhs, R_ rhs) noexcept {
+	const int_step<T_> step = int_ops::div<T_>(lhs.get(), raw_int(rhs));
+	if (!step.ok) [[unlikely]] return step.fail;
+	return safe_int<T_, P_>{step.val};
+}
+
+/// @returns `lhs * mul / div` with a 128-bit product, or the `err` it failed with. Never throws.
+template <typename P_>
+[[nodiscard]] constexpr result<safe_int<u64_t, P_>> checked_mul_div(safe_int<u64_t, P_> lhs, u64_t mul, u64_t div) noexcept {
+	const int_step<u64_t> step = int_ops::mul_div(lhs.get(), mul, div);
+	if (!step.ok) [[unlikely]] return step.fail;
+	return safe_int<u64_t, P_>{step.val};
+}
+
+/// @returns `lhs * mul + add` with a 128-bit product, or the `err` it failed with. Never throws.
+template <typename P_>
+[[nodiscard]] constexpr result<safe_int<u64_t, P_>> checked_mul_add(safe_int<u64_t, P_> lhs, u64_t mul, u64_t add) noexcept {
+	const int_step<u64_t> step = int_ops::mul_add(lhs.get(), mul, add);
+	if (!step.ok) [[unlikely]] return step.fail;
+	return safe_int<u64_t, P_>{step.val};
+}
+
+#pragma endregion /// Checked operations
+
+/// @class `sticky_int`
+/// @brief An accumulator which remembers the first failed operation instead of throwing.
+/// @section Features:
+/// - Performs arithmetic operations (+=, -=, *=, /=) checked like `safe_int`, but never throws.
+/// - The first failure is latched, every later operation becomes a no-op.
+/// - A batch of operations is checked once at the end through `get_result()`.
+/// - Same size as `result<T_>`, the value and a `u8_t` tag.
+template <typename T_>
+	requires std::is_integral_v<T_>
+class sticky_int {
+private:
+	static constexpr u8_t _OK = 0xFF;
+
+	T_ _val {0};
+	u8_t _tag {_OK};
+
+#pragma region /// Helpers
+
+	constexpr void _apply(const int_step<T_>& step) noexcept {
+		if (step.ok) [[likely]] _val = step.val;
+		else _tag = static_cast<u8_t>(step.fail);
+	}
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Constructors
+
+	[[nodiscard]] constexpr sticky_int() noexcept = default;
+
+	template <typename R_>
+		requires int_operand<R_>
+	[[nodiscard]] constexpr sticky_int(R_ val) noexcept : _val{int_ops::clamp<T_>(raw_int(val))} {}
+
+#pragma endregion /// Constructors
+#pragma region /// Operations
+
+	template <typename R_>
+		requires int_operand<R_>
+	constexpr sticky_int& operator+=(R_ rhs) noexcept {
+		if (_tag == _OK) [[likely]] _apply(int_ops::add<T_>(_val, raw_int(rhs)));
+		return *this;
+	}
+
+	template <typename R_>
+		requires int_operand<R_>
+	constexpr sticky_int& operator-=(R_ rhs) noexcept {
+		if (_tag == _OK) [[likely]] _apply(int_ops::sub<T_>(_val, raw_int(rhs)));
+		return *this;
+	}
+
+	template <typename R_>
+		requires int_operand<R_>
+	constexpr sticky_int& operator*=(R_ rhs) noexcept {
+		if (_tag == _OK) [[likely]] _apply(int_ops::mul<T_>(_val, raw_int(rhs)));
+		return *this;
+	}
+
+	template <typename R_>
+		requires int_operand<R_>
+	constexpr sticky_int& operator/=(R_ rhs) noexcept {
+		if (_tag == _OK) [[likely]] _apply(int_ops::div<T_>(_val, raw_int(rhs)));
+		return *this;
+	}
+
+#pragma endregion /// Operations
+#pragma region /// Result utils
+
+	/// @returns `true` if no operation has failed so far
+	[[nodiscard]] constexpr bool is_ok() const noexcept { return _tag == _OK; }
+
+	/// @returns The accumulated value, or the first `err` met
+	[[nodiscard]] constexpr result<safe_int<T_>> get_result() const noexcept {
+		if (_tag != _OK) [[unlikely]] return static_cast<err>(_tag);
+		return safe_int<T_>{_val};
+	}
+
+	/// @details Drops the latched `err` and restarts from `val`
+	template <typename R_ = T_>
+		requires int_operand<R_>
+	constexpr void reset(R_ val = 0) noexcept {
+		_val = int_ops::clamp<T_>(raw_int(val));
+		_tag = _OK;
+	}
+
+#pragma endregion /// Result utils
+};
+
+typedef sticky_int<u64_t> sticky_u64;
+
+} /// namespace xen
+
+#endif /// XEN_CHECKED
@@ -0,0 +1,203 @@
+#pragma once
+
+#ifndef XEN_CHECKED_REDUCE
+#define XEN_CHECKED_REDUCE
+
+#include <span>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif /// __AVX2__
+
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+
+namespace xen {
+
+/// @namespace `_checked_reduce`
+/// @details Branch-free kernels, each returns `false` if the exact result doesn't fit `u64_t`
+namespace _checked_reduce {
+
+/// @details No.of elements between two overflow checks, bounds the work wasted on a failing batch
+inline constexpr u64_t BATCH = 4096;
+
+/// @details Sums `[it, it + len)` into `sum`, counting every carry out of the 64 bits
+[[nodiscard]] inline bool sum(const u64_t* it, u64_t len, u64_t& sum) noexcept {
+	constexpr u64_t LANES = 8;
+	u64_t lane_sum[LANES] {};
+	u64_t lane_carry[LANES] {};
+	u64_t i = 0;
+
+	#ifdef __AVX2__
+	/// unsigned `a < b` as a signed compare of both operands with the sign bit flipped
+	const __m256i flip = _mm256_set1_epi64x(static_cast<i64_t>(u64_t{1} << 63));
+	__m256i sum_a = _mm256_setzero_si256(), sum_b = _mm256_setzero_si256();
+	__m256i carry_a = _mm256_setzero_si256(), carry_b = _mm256_setzero_si256();
+
+	for (; i + LANES <= len; i += LANES) {
+		const __m256i x_a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it + i));
+		const __m256i x_b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it + i + 4));
+		sum_a = _mm256_add_epi64(sum_a, x_a);
+		sum_b = _mm256_add_epi64(sum_b, x_b);
+
+		/// a lane wrapped iff its new sum is below the value just added (mask is -1 on carry)
+		carry_a = _mm256_sub_epi64(carry_a, _mm256_cmpgt_epi64(
+			_mm256_xor_si256(x_a, flip), _mm256_xor_si256(sum_a, flip)));
+		carry_b = _mm256_sub_epi64(carry_b, _mm256_cmpgt_epi64(
+			_mm256_xor_si256(x_b, flip), _mm256_xor_si256(sum_b, flip)));
+	}
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_sum), sum_a);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_sum + 4), sum_b);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_carry), carry_a);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_carry + 4), carry_b);
+	#else
+	/// independent lanes, left for the auto-vectorizer
+	for (; i + LANES <= len; i += LANES) {
+		for (u64_t lane = 0; lane < LANES; ++lane) {
+			lane_sum[lane] += it[i + lane];
+			lane_carry[lane] += lane_sum[lane] < it[i + lane];
+		}
+	}
+	#endif /// __AVX2__
+
+	u64_t total = 0, carry = 0;
+	for (u64_t lane = 0; lane < LANES; ++lane) {
+		total += lane_sum[lane];
+		carry += lane_carry[lane] + (total < lane_sum[lane]);
+	}
+
+	for (; i < len; ++i) {
+		total += it[i];
+		carry += total < it[i];
+	}
+
+	sum = total;
+	return carry == 0;
+}
+
+/// @details Sums the products of `[a, a + len)` and `[b, b + len)` into `sum`
+[[nodiscard]] inline bool dot(const u64_t* a, const u64_t* b, u64_t len, u64_t& sum) noexcept {
+	#ifdef __SIZEOF_INT128__
+	/// every term is non negative, so any 128-bit partial sum past 64 bits already means overflow
+	unsigned __int128 total = 0;
+	u64_t carry = 0;
+
+	for (u64_t i = 0; i < len; ++i) {
+		const unsigned __int128 prod = static_cast<unsigned __int128>(a[i]) * b[i];
+		total += prod;
+		carry += total < prod;
+	}
+
+	sum = static_cast<u64_t>(total);
+	return carry == 0 && (total >> 64) == 0;
+	#else
+	u64_t total = 0;
+	bool failed = false;
+
+	for (u64_t i = 0; i < len; ++i) {
+		const int_step<u64_t> prod = int_ops::mul<u64_t>(a[i], b[i]);
+		const int_step<u64_t> next = int_ops::add<u64_t>(total, prod.val);
+		failed |= !prod.ok | !next.ok;
+		total = next.val;
+	}
+
+	sum = total;
+	return !failed;
+	#endif /// __SIZEOF_INT128__
+}
+
+/// @details Multiplies `[it, it + len)` into `prod`, `has_zero` is set if a `0` was met
+[[nodiscard]] inline bool product(const u64_t* it, u64_t len, u64_t& prod, bool& has_zero) noexcept {
+	u64_t total = prod;
+	bool failed = false;
+
+	for (u64_t i = 0; i < len; ++i) {
+		const int_step<u64_t> next = int_ops::mul<u64_t>(total, it[i]);
+		failed |= !next.ok;
+		has_zero |= it[i] == 0;
+		total = next.val;
+	}
+
+	prod = total;
+	return !failed;
+}
+
+} /// namespace _checked_reduce
+
+#pragma region /// Checked reductions
+
+/// @returns Sum of every element of `data`
+/// @details Accumulates in independent (AVX2) lanes with carry counting, checks once per batch
+/// @note Throws `err::NumOverflow` if the sum exceeds `u64_t`, at every `XEN_CHECK_LEVEL`
+[[nodiscard]] inline safe_u64 checked_sum(std::span<const u64_t> data) {
+	u64_t total = 0;
+
+	for (u64_t i = 0; i < data.size(); i += _checked_reduce::BATCH) {
+		const u64_t len = data.size() - i < _checked_reduce::BATCH ? data.size() - i : _checked_reduce::BATCH;
+
+		u64_t part = 0;
+		if (!_checked_reduce::sum(data.data() + i, len, part)) [[unlikely]] throw err::NumOverflow;
+
+		const int_step<u64_t> next = int_ops::add<u64_t>(total, part);
+		if (!next.ok) [[unlikely]] throw err::NumOverflow;
+		total = next.val;
+	}
+
+	return safe_u64{total};
+}
+
+/// @returns Sum of the element-wise products of `lhs` and `rhs`
+/// @details Products are kept in 128 bits (where available) and checked once per batch
+/// @note Throws `err::NumOverflow` if the result exceeds `u64_t`,
+/// `err::InvalidArgument` if the spans differ in length
+[[nodiscard]] inline safe_u64 checked_dot(std::span<const u64_t> lhs, std::span<const u64_t> rhs) {
+	if (lhs.size() != rhs.size()) throw err::InvalidArgument;
+
+	u64_t total = 0;
+
+	for (u64_t i = 0; i < lhs.size(); i += _checked_reduce::BATCH) {
+		const u64_t len = lhs.size() - i < _checked_reduce::BATCH ? lhs.size() - i : _checked_reduce::BATCH;
+
+		u64_t part = 0;
+		if (!_checked_reduce::dot(lhs.data() + i, rhs.data() + i, len, part)) [[unlikely]] throw err::NumOverflow;
+
+		const int_step<u64_t> next = int_ops::add<u64_t>(total, part);
+		if (!next.ok) [[unlikely]] throw err::NumOverflow;
+		total = next.val;
+	}
+
+	return safe_u64{total};
+}
+
+/// @returns Product of every element of `data` (`1` if empty)
+/// @details Overflow flags are OR-ed together and checked once per batch
+/// @note Throws `err::NumOverflow` if the product exceeds `u64_t` (a `0` anywhere makes it fit)
+[[nodiscard]] inline safe_u64 checked_product(std::span<const u64_t> data) {
+	u64_t total = 1;
+	bool has_zero = false;
+
+	for (u64_t i = 0; i < data.size(); i += _checked_reduce::BATCH) {
+		const u64_t len = data.size() - i < _checked_reduce::BATCH ? data.size() - i : _checked_reduce::BATCH;
+
+		if (!_checked_reduce::product(data.data() + i, len, total, has_zero)) [[unlikely]] {
+			/// only a later `0` can still rescue the result
+			for (u64_t j = i + len; j < data.size() && !has_zero; ++j) has_zero = data[j] == 0;
+			if (has_zero) return safe_u64{0};
+
+			throw err::NumOverflow;
+		}
+
+		if (has_zero) return safe_u64{0};
+	}
+
+	return safe_u64{total};
+}
+
+#pragma endregion /// Checked reductions
+
+} /// namespace xen
+
+#endif /// XEN_CHECKED_REDUCE
@@ -13,11 +13,46 @@
 #define XEN_VER_MAJOR 0
 #define XEN_VER_MINOR 3
 
+/// @section Opt-in features (define before including `xen`):
+/// - `XEN_USE_STR_POOL`       : `str` recycles its character buffers through a thread-local `str_pool`.
+/// - `XEN_INT_OPS_PORTABLE`   : `int_ops` skips the `__builtin_*_overflow` fast path on GCC/Clang.
+/// - `XEN_SAFE_INT_TELEMETRY` : `safe_int` operations record per call site counters into `int_telemetry`.
+/// - `XEN_ERR_CTX_TRACE`      : `err_ctx` captures a frame pointer stack trace, symbolized when printed.
+
+/// @section Check levels (define `XEN_CHECK_LEVEL` before including `xen`):
+/// - `XEN_CHECK_FULL` (default) : Preconditions are checked, failures throw their `err`.
+/// - `XEN_CHECK_DEBUG`          : Preconditions are `assert`ed, so they vanish when `NDEBUG` is defined.
+/// - `XEN_CHECK_NONE`           : Preconditions are assumed to hold, no checking code is generated.
+/// @note Honored by `XEN_CHECK` users: the default `safe_int` policy, `str` / `str_slice` indexing,
+/// and the null checks of the ref types. APIs which exist to report errors (`checked_*`, `result`) always check.
+#define XEN_CHECK_NONE 0
+#define XEN_CHECK_DEBUG 1
+#define XEN_CHECK_FULL 2
+
+#ifndef XEN_CHECK_LEVEL
+#define XEN_CHECK_LEVEL XEN_CHECK_FULL
+#endif /// XEN_CHECK_LEVEL
+
+/// @details `XEN_CHECK(cond, fail)` : throws `fail` (an `err`) unless `cond` holds, per `XEN_CHECK_LEVEL`
+#if XEN_CHECK_LEVEL == XEN_CHECK_FULL
+#define XEN_CHECK(cond, fail) do { if (!(cond)) [[unlikely]] throw (fail); } while (false)
+#elif XEN_CHECK_LEVEL == XEN_CHECK_DEBUG
+#include <cassert>
+#define XEN_CHECK(cond, fail) assert((cond) && #fail)
+#elif XEN_CHECK_LEVEL == XEN_CHECK_NONE
+#define XEN_CHECK(cond, fail) ((void)0)
+#else
+#error "XEN_CHECK_LEVEL must be XEN_CHECK_FULL, XEN_CHECK_DEBUG or XEN_CHECK_NONE"
+#endif /// XEN_CHECK_LEVEL
+
 namespace xen {
 
 inline constexpr u64_t VER_MAJOR = XEN_VER_MAJOR;
 inline constexpr u64_t VER_MINOR = XEN_VER_MINOR;
 
+/// @details `true` when `XEN_CHECK` never throws, for `noexcept(CHECK_NOTHROW)` on checked functions
+inline constexpr bool CHECK_NOTHROW = XEN_CHECK_LEVEL != XEN_CHECK_FULL;
+
 } /// namespace xen
 
 #endif /// XEN_CONFIG
\ No newline at end of file
@@ -0,0 +1,201 @@
+#pragma once
+
+#ifndef XEN_FAST_DIVIDER
+#define XEN_FAST_DIVIDER
+
+#include <span>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif /// __AVX2__
+
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+
+namespace xen {
+
+/// @struct `divmod_result`
+/// @brief Quotient and remainder of a single division.
+template <typename T_>
+struct divmod_result {
+	T_ quot;
+	T_ rem;
+};
+
+/// @class `fast_divider`
+/// @brief Divides `u64_t` / `safe_u64` values by a runtime-invariant divisor without a `div` instruction.
+/// @section Features:
+/// - Precomputes a multiply-and-shift reciprocal once at construction (libdivide's u64 algorithm).
+/// - Each division is then a 64x64 high multiply, a shift and (for some divisors) an add.
+/// - Powers of two (including `1`) turn into a single shift.
+/// - Supports `/`, `%` and `divmod` for `u64_t` and `safe_u64`, and a batch `divide` over spans
+///   which decides the algorithm once per batch (AVX2 on four values at a time where available).
+/// - Throws at construction:
+/// --> `err::DivideByZero` : The divisor is zero.
+class fast_divider {
+private:
+	static constexpr u8_t _SHIFT_MASK = 0x3F;
+	static constexpr u8_t _ADD_MARKER = 0x40;
+
+	u64_t _magic {0};
+	u64_t _div {1};
+	u8_t _more {0};
+
+#pragma region /// Helpers
+
+	[[nodiscard]] static constexpr u8_t _log2(u64_t val) noexcept {
+		u8_t res = 0;
+		while (val >>= 1) ++res;
+		return res;
+	}
+
+	/// @returns The high 64 bits of `a * b`
+	[[nodiscard]] static constexpr u64_t _mulhi(u64_t a, u64_t b) noexcept {
+		u64_t hi = 0;
+		(void)int_ops::_mul_wide(a, b, hi);
+		return hi;
+	}
+
+	[[nodiscard]] constexpr u64_t _quot_shift(u64_t num) const noexcept { return num >> _more; }
+
+	[[nodiscard]] constexpr u64_t _quot_mul(u64_t num) const noexcept { return _mulhi(_magic, num) >> _more; }
+
+	[[nodiscard]] constexpr u64_t _quot_add(u64_t num) const noexcept {
+		const u64_t q = _mulhi(_magic, num);
+		return (((num - q) >> 1) + q) >> (_more & _SHIFT_MASK);
+	}
+
+	#ifdef __AVX2__
+	/// @returns The high 64 bits of each `a * b` lane, `b_lo` & `b_hi` being the halves of a broadcast `b`
+	[[nodiscard]] static __m256i _mulhi_avx2(__m256i a, __m256i b_lo, __m256i b_hi) noexcept {
+		const __m256i lo32 = _mm256_set1_epi64x(U32_MAX);
+		const __m256i a_hi = _mm256_srli_epi64(a, 32);
+
+		const __m256i lo_lo = _mm256_mul_epu32(a, b_lo);
+		const __m256i hi_lo = _mm256_mul_epu32(a_hi, b_lo);
+		const __m256i lo_hi = _mm256_mul_epu32(a, b_hi);
+		const __m256i hi_hi = _mm256_mul_epu32(a_hi, b_hi);
+
+		const __m256i mid = _mm256_add_epi64(hi_lo, _mm256_srli_epi64(lo_lo, 32));
+		const __m256i cross = _mm256_add_epi64(_mm256_and_si256(mid, lo32), lo_hi);
+		return _mm256_add_epi64(_mm256_add_epi64(hi_hi, _mm256_srli_epi64(mid, 32)), _mm256_srli_epi64(cross, 32));
+	}
+	#endif /// __AVX2__
+
+	/// @details Divides `[in, in + len)` into `out` with one of the `_quot_*` kernels
+	template <u8_t ALGO_>
+	void _divide_batch(const u64_t* in, u64_t* out, u64_t len) const noexcept {
+		u64_t i = 0;
+
+		#ifdef __AVX2__
+		const __m256i b_lo = _mm256_set1_epi64x(static_cast<i64_t>(_magic & U32_MAX));
+		const __m256i b_hi = _mm256_set1_epi64x(static_cast<i64_t>(_magic >> 32));
+		const __m128i shift = _mm_cvtsi32_si128(_more & _SHIFT_MASK);
+
+		for (; i + 4 <= len; i += 4) {
+			const __m256i num = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+			__m256i quot;
+
+			if constexpr (ALGO_ == 0) quot = _mm256_srl_epi64(num, shift);
+			else if constexpr (ALGO_ == 1) quot = _mm256_srl_epi64(_mulhi_avx2(num, b_lo, b_hi), shift);
+			else {
+				const __m256i q = _mulhi_avx2(num, b_lo, b_hi);
+				quot = _mm256_srl_epi64(_mm256_add_epi64(_mm256_srli_epi64(_mm256_sub_epi64(num, q), 1), q), shift);
+			}
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), quot);
+		}
+		#endif /// __AVX2__
+
+		for (; i < len; ++i) {
+			if constexpr (ALGO_ == 0) out[i] = _quot_shift(in[i]);
+			else if constexpr (ALGO_ == 1) out[i] = _quot_mul(in[i]);
+			else out[i] = _quot_add(in[i]);
+		}
+	}
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Constructors
+
+	[[nodiscard]] constexpr explicit fast_divider(u64_t div) : _div{div} {
+		if (div == 0) [[unlikely]] throw err::DivideByZero;
+
+		const u8_t floor_log2 = _log2(div);
+
+		if ((div & (div - 1)) == 0) {
+			_more = floor_log2;
+			return;
+		}
+
+		u64_t rem = 0;
+		u64_t proposed = int_ops::_div_wide(u64_t{1} << floor_log2, 0, div, rem);
+
+		if (div - rem < (u64_t{1} << floor_log2)) {
+			/// the magic number fits 64 bits, a plain multiply & shift
+			_more = floor_log2;
+		} else {
+			/// 65-bit magic number, the extra bit is folded into an add
+			proposed += proposed;
+			const u64_t twice_rem = rem + rem;
+			if (twice_rem >= div || twice_rem < rem) proposed += 1;
+			_more = floor_log2 | _ADD_MARKER;
+		}
+
+		_magic = proposed + 1;
+	}
+
+	[[nodiscard]] constexpr explicit fast_divider(safe_u64 div) : fast_divider{div.get()} {}
+
+	/// @returns The divisor
+	[[nodiscard]] constexpr u64_t get_divisor() const noexcept { return _div; }
+
+#pragma endregion /// Constructors
+#pragma region /// Operations
+
+	/// @returns `num / divisor`
+	[[nodiscard]] constexpr u64_t divide(u64_t num) const noexcept {
+		if (_magic == 0) return _quot_shift(num);
+		if (_more & _ADD_MARKER) return _quot_add(num);
+		return _quot_mul(num);
+	}
+
+	/// @returns `num % divisor`
+	[[nodiscard]] constexpr u64_t modulo(u64_t num) const noexcept { return num - divide(num) * _div; }
+
+	/// @returns `num / divisor` and `num % divisor`
+	[[nodiscard]] constexpr divmod_result<u64_t> divmod(u64_t num) const noexcept {
+		const u64_t quot = divide(num);
+		return divmod_result<u64_t>{quot, num - quot * _div};
+	}
+
+	[[nodiscard]] constexpr divmod_result<safe_u64> divmod(safe_u64 num) const noexcept {
+		const divmod_result<u64_t> res = divmod(num.get());
+		return divmod_result<safe_u64>{res.quot, res.rem};
+	}
+
+	/// @details Writes `in[i] / divisor` into `out[i]` for every element of `in`
+	/// @note Throws `err::IndexOutOfRange` if `out` is smaller than `in`
+	void divide(std::span<const u64_t> in, std::span<u64_t> out) const {
+		if (out.size() < in.size()) throw err::IndexOutOfRange;
+
+		if (_magic == 0) _divide_batch<0>(in.data(), out.data(), in.size());
+		else if (_more & _ADD_MARKER) _divide_batch<2>(in.data(), out.data(), in.size());
+		else _divide_batch<1>(in.data(), out.data(), in.size());
+	}
+
+	[[nodiscard]] friend constexpr u64_t operator/(u64_t num, const fast_divider& div) noexcept { return div.divide(num); }
+	[[nodiscard]] friend constexpr u64_t operator%(u64_t num, const fast_divider& div) noexcept { return div.modulo(num); }
+
+	[[nodiscard]] friend constexpr safe_u64 operator/(safe_u64 num, const fast_divider& div) noexcept { return div.divide(num.get()); }
+	[[nodiscard]] friend constexpr safe_u64 operator%(safe_u64 num, const fast_divider& div) noexcept { return div.modulo(num.get()); }
+
+#pragma endregion /// Operations
+};
+
+} /// namespace xen
+
+#endif /// XEN_FAST_DIVIDER
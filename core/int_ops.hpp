@@ -0,0 +1,249 @@
+#pragma once
+
+#ifndef XEN_INT_OPS
+#define XEN_INT_OPS
+
+#include <limits>
+#include <type_traits>
+
+#include "core/numdef.hpp"
+#include "err/err.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(XEN_INT_OPS_PORTABLE)
+#define XEN_INT_OPS_BUILTIN
+#endif /// __GNUC__ || __clang__
+
+namespace xen {
+
+/// @struct `int_step`
+/// @brief Outcome of a checked arithmetic step on `T_`.
+/// @section Members:
+/// - val  : Exact result if `ok`, otherwise the result wrapped around `T_` (two's complement).
+/// - bound: `T_` limit the exact result went past (`T_` max on overflow, `T_` min on underflow).
+/// - fail : Why the step failed (`err::NumOverflow`, `err::NumUnderflow`, `err::DivideByZero`).
+/// - ok   : `true` if the exact result is representable by `T_`.
+template <typename T_>
+struct int_step {
+	T_ val {0};
+	T_ bound {0};
+	err fail {err::Logic};
+	bool ok {true};
+};
+
+/// @namespace `int_ops`
+/// @brief Checked arithmetic building blocks shared by `safe_int` and friends.
+/// @section Features:
+/// - Operands may be any mix of integer types, signedness and widths.
+/// - Results are computed exactly, then checked against the range of the result type `T_`.
+/// - Never throws, failures are described by the returned `int_step`.
+/// - On GCC/Clang the success path is `__builtin_*_overflow` (the instruction plus a flag branch),
+///   the exact sign & magnitude path only runs to describe a failure.
+///   Define `XEN_INT_OPS_PORTABLE` to always use the portable path.
+namespace int_ops {
+
+#pragma region /// Helpers
+
+/// @details Sign & magnitude form, exact for every 64-bit or narrower integer
+struct _wide {
+	u64_t mag {0};
+	bool neg {false};
+};
+
+template <typename R_>
+	requires std::is_integral_v<R_>
+[[nodiscard]] constexpr _wide _to_wide(R_ val) noexcept {
+	if constexpr (std::is_signed_v<R_>) {
+		if (val < 0) return _wide{u64_t{0} - static_cast<u64_t>(val), true};
+	}
+
+	return _wide{static_cast<u64_t>(val), false};
+}
+
+[[nodiscard]] constexpr _wide _negate(_wide val) noexcept {
+	return _wide{val.mag, val.mag != 0 && !val.neg};
+}
+
+template <typename T_>
+[[nodiscard]] constexpr int_step<T_> _ok(T_ val) noexcept { return int_step<T_>{val, val, err::Logic, true}; }
+
+/// @details Turns an exact result (`carry` set if its magnitude went past 64 bits) into a step
+template <typename T_>
+[[nodiscard]] constexpr int_step<T_> _settle(_wide res, bool carry) noexcept {
+	constexpr u64_t MAX_MAG = static_cast<u64_t>(std::numeric_limits<T_>::max());
+	constexpr u64_t MIN_MAG = std::is_signed_v<T_> ? MAX_MAG + 1 : 0;
+
+	const T_ val = static_cast<T_>(res.neg ? u64_t{0} - res.mag : res.mag);
+	if (!carry && res.mag <= (res.neg ? MIN_MAG : MAX_MAG)) [[likely]] return _ok(val);
+
+	return res.neg
+		? int_step<T_>{val, std::numeric_limits<T_>::min(), err::NumUnderflow, false}
+		: int_step<T_>{val, std::numeric_limits<T_>::max(), err::NumOverflow, false};
+}
+
+[[nodiscard]] constexpr _wide _add_wide(_wide a, _wide b, bool& carry) noexcept {
+	carry = false;
+
+	if (a.neg == b.neg) {
+		const u64_t mag = a.mag + b.mag;
+		carry = mag < a.mag;
+		return _wide{mag, a.neg};
+	}
+
+	if (a.mag >= b.mag) return _wide{a.mag - b.mag, a.neg && a.mag != b.mag};
+	return _wide{b.mag - a.mag, b.neg};
+}
+
+/// @returns `true` if the multiplication doesn't overflow `U64_MAX`
+[[nodiscard]] constexpr bool _is_safe_mul(u64_t a, u64_t b) noexcept {
+	#ifdef __SIZEOF_INT128__
+	return ((static_cast<unsigned __int128>(a) * b) >> 64) == 0;
+	#else
+	if (b == 0) return true;
+	return a <= (U64_MAX / b);
+	#endif /// __SIZEOF_INT128__
+}
+
+/// @returns The low 64 bits of `a * b`, `hi` set to the high 64 bits
+[[nodiscard]] constexpr u64_t _mul_wide(u64_t a, u64_t b, u64_t& hi) noexcept {
+	#ifdef __SIZEOF_INT128__
+	const unsigned __int128 res = static_cast<unsigned __int128>(a) * b;
+	hi = static_cast<u64_t>(res >> 64);
+	return static_cast<u64_t>(res);
+	#else
+	const u64_t a_lo = a & U32_MAX, a_hi = a >> 32;
+	const u64_t b_lo = b & U32_MAX, b_hi = b >> 32;
+	const u64_t lo_lo = a_lo * b_lo;
+	const u64_t mid = a_hi * b_lo + (lo_lo >> 32);
+	const u64_t cross = (mid & U32_MAX) + a_lo * b_hi;
+
+	hi = a_hi * b_hi + (mid >> 32) + (cross >> 32);
+	return (cross << 32) | (lo_lo & U32_MAX);
+	#endif /// __SIZEOF_INT128__
+}
+
+/// @returns `(hi * 2^64 + lo) / den`, `rem` set to the remainder
+/// @warning `hi` must be below `den`, so the quotient fits 64 bits
+[[nodiscard]] constexpr u64_t _div_wide(u64_t hi, u64_t lo, u64_t den, u64_t& rem) noexcept {
+	#ifdef __SIZEOF_INT128__
+	const unsigned __int128 num = (static_cast<unsigned __int128>(hi) << 64) | lo;
+	rem = static_cast<u64_t>(num % den);
+	return static_cast<u64_t>(num / den);
+	#else
+	/// restoring long division, one quotient bit per `lo` bit
+	u64_t quot = 0;
+	for (u8_t bit = 0; bit < 64; ++bit) {
+		const bool carry = hi >> 63;
+		hi = (hi << 1) | (lo >> 63);
+		lo <<= 1;
+		quot <<= 1;
+		if (carry || hi >= den) {
+			hi -= den;
+			quot |= 1;
+		}
+	}
+
+	rem = hi;
+	return quot;
+	#endif /// __SIZEOF_INT128__
+}
+
+#pragma endregion /// Helpers
+#pragma region /// Operations
+
+/// @returns `val` clamped into the range of `T_`
+template <typename T_, typename R_>
+	requires std::is_integral_v<T_> && std::is_integral_v<R_>
+[[nodiscard]] constexpr T_ clamp(R_ val) noexcept {
+	const int_step<T_> res = _settle<T_>(_to_wide(val), false);
+	return res.ok ? res.val : res.bound;
+}
+
+/// @returns `a + b` checked against the range of `T_`
+template <typename T_, typename A_, typename B_>
+	requires std::is_integral_v<T_> && std::is_integral_v<A_> && std::is_integral_v<B_>
+[[nodiscard]] constexpr int_step<T_> add(A_ a, B_ b) noexcept {
+	#ifdef XEN_INT_OPS_BUILTIN
+	if (T_ res; !__builtin_add_overflow(a, b, &res)) [[likely]] return _ok(res);
+	#endif /// XEN_INT_OPS_BUILTIN
+
+	bool carry = false;
+	const _wide res = _add_wide(_to_wide(a), _to_wide(b), carry);
+	return _settle<T_>(res, carry);
+}
+
+/// @returns `a - b` checked against the range of `T_`
+template <typename T_, typename A_, typename B_>
+	requires std::is_integral_v<T_> && std::is_integral_v<A_> && std::is_integral_v<B_>
+[[nodiscard]] constexpr int_step<T_> sub(A_ a, B_ b) noexcept {
+	#ifdef XEN_INT_OPS_BUILTIN
+	if (T_ res; !__builtin_sub_overflow(a, b, &res)) [[likely]] return _ok(res);
+	#endif /// XEN_INT_OPS_BUILTIN
+
+	bool carry = false;
+	const _wide res = _add_wide(_to_wide(a), _negate(_to_wide(b)), carry);
+	return _settle<T_>(res, carry);
+}
+
+/// @returns `a * b` checked against the range of `T_`
+template <typename T_, typename A_, typename B_>
+	requires std::is_integral_v<T_> && std::is_integral_v<A_> && std::is_integral_v<B_>
+[[nodiscard]] constexpr int_step<T_> mul(A_ a, B_ b) noexcept {
+	#ifdef XEN_INT_OPS_BUILTIN
+	if (T_ res; !__builtin_mul_overflow(a, b, &res)) [[likely]] return _ok(res);
+	#endif /// XEN_INT_OPS_BUILTIN
+
+	const _wide wa = _to_wide(a);
+	const _wide wb = _to_wide(b);
+	const u64_t mag = wa.mag * wb.mag;
+
+	const bool neg = wa.neg != wb.neg && wa.mag != 0 && wb.mag != 0;
+	return _settle<T_>(_wide{mag, neg}, !_is_safe_mul(wa.mag, wb.mag));
+}
+
+/// @returns `a / b` (truncated towards zero) checked against the range of `T_`
+/// @note On `err::DivideByZero` both `val` and `bound` hold `a` clamped into `T_`
+template <typename T_, typename A_, typename B_>
+	requires std::is_integral_v<T_> && std::is_integral_v<A_> && std::is_integral_v<B_>
+[[nodiscard]] constexpr int_step<T_> div(A_ a, B_ b) noexcept {
+	if (b == 0) [[unlikely]] {
+		const T_ keep = clamp<T_>(a);
+		return int_step<T_>{keep, keep, err::DivideByZero, false};
+	}
+
+	const _wide wa = _to_wide(a);
+	const _wide wb = _to_wide(b);
+	const u64_t mag = wa.mag / wb.mag;
+
+	return _settle<T_>(_wide{mag, mag != 0 && wa.neg != wb.neg}, false);
+}
+
+/// @returns `a * b / c` (truncated) checked against `u64_t`, `a * b` is kept in 128 bits
+/// @note Only fails if the final quotient doesn't fit, on `err::DivideByZero` both `val` and `bound` hold `a`
+[[nodiscard]] constexpr int_step<u64_t> mul_div(u64_t a, u64_t b, u64_t c) noexcept {
+	if (c == 0) [[unlikely]] return int_step<u64_t>{a, a, err::DivideByZero, false};
+
+	u64_t hi = 0, rem = 0;
+	const u64_t lo = _mul_wide(a, b, hi);
+	if (hi < c) [[likely]] return _ok(_div_wide(hi, lo, c, rem));
+
+	/// the quotient needs more than 64 bits, `val` keeps its low half
+	return int_step<u64_t>{_div_wide(hi % c, lo, c, rem), U64_MAX, err::NumOverflow, false};
+}
+
+/// @returns `a * b + c` checked against `u64_t`, `a * b` is kept in 128 bits
+[[nodiscard]] constexpr int_step<u64_t> mul_add(u64_t a, u64_t b, u64_t c) noexcept {
+	u64_t hi = 0;
+	const u64_t lo = _mul_wide(a, b, hi);
+	const u64_t res = lo + c;
+
+	if (hi == 0 && res >= lo) [[likely]] return _ok(res);
+	return int_step<u64_t>{res, U64_MAX, err::NumOverflow, false};
+}
+
+#pragma endregion /// Operations
+
+} /// namespace int_ops
+
+} /// namespace xen
+
+#endif /// XEN_INT_OPS
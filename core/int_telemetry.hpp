@@ -0,0 +1,294 @@
+#pragma once
+
+#ifndef XEN_INT_TELEMETRY
+#define XEN_INT_TELEMETRY
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <source_location>
+#include <span>
+
+#include "core/numdef.hpp"
+
+namespace xen {
+
+/// @struct `int_site_stats`
+/// @brief Counters of one checked operation call site, as recorded by one thread.
+struct int_site_stats {
+	const char* file {nullptr};     /// Source file of the operation
+	const char* function {nullptr}; /// Enclosing function of the operation
+	u32_t line {0};
+	u32_t column {0};
+	u64_t thread {0};               /// Registration order of the recording thread, `EXITED` for merged exited threads
+	u64_t calls {0};                /// Operations run at the site
+	u64_t fails {0};                /// Operations which overflowed, underflowed or divided by zero
+	u64_t peak {0};                 /// Largest result magnitude seen (the limit itself on failure)
+	u64_t limit {0};                /// Largest magnitude the result type holds
+};
+
+/// @class `int_telemetry`
+/// @brief Per call site counters of `safe_int` operations.
+/// @warning Only recorded when `XEN_SAFE_INT_TELEMETRY` is defined (see core/config.hpp)
+/// @section Features:
+/// - Call sites are captured through `std::source_location` when the operand converts to `_site_arg`.
+/// - Each thread records into its own fixed size table, no locks and no read-modify-write atomics.
+/// - Tables are registered once in a global lock-free list and pooled: an exiting thread merges its counters
+///   into one shared table of exited threads and hands its table to the next new thread, so memory is bounded
+///   by the most threads alive at once and `visit` still reports threads which already exited.
+/// - Recording never throws, a table which can't be allocated only counts the operations as dropped.
+/// - `peak` against `limit` tells how close a site ever came to overflowing.
+/// @note `++`, `--`, reversed operands (`1 + x`) and binary operators with a raw integer operand (`x + 1`)
+/// can't capture their site, they are counted per `safe_int` type at their operator in core/safe_int.hpp.
+/// Compound operators (`x += 1`) and binary operators between `safe_int`s (`x + y`) are always attributed.
+class int_telemetry {
+private:
+	static constexpr u64_t _CAPACITY = 1024;
+
+	struct _slot {
+		std::atomic<const char*> file {nullptr};
+		const char* function {nullptr};
+		u32_t line {0};
+		u32_t column {0};
+		u64_t limit {0};
+		std::atomic<u64_t> calls {0};
+		std::atomic<u64_t> fails {0};
+		std::atomic<u64_t> peak {0};
+	};
+
+	struct _table {
+		_slot slots[_CAPACITY] {};
+		std::atomic<u64_t> dropped {0};
+		std::atomic<u64_t> thread {0};
+		std::atomic<bool> in_use {true};
+		_table* next {nullptr};
+	};
+
+	/// @details Hands the calling thread's table back to the pool when the thread exits
+	struct _owner {
+		_table* table {nullptr};
+		~_owner() { if (table != nullptr) _retire(*table); }
+	};
+
+	static inline std::atomic<_table*> _head {nullptr};
+	static inline std::atomic<u64_t> _thread_count {0};
+	static inline std::atomic<u64_t> _unallocated {0};
+
+	static inline std::mutex _exited_lock {};
+
+#pragma region /// Helpers
+
+	/// @returns The counters of exited threads, only written under `_exited_lock`
+	[[nodiscard]] static _table& _exited() noexcept {
+		static _table exited {};
+		return exited;
+	}
+
+	/// @returns A free pooled table, or a new registered one, `nullptr` if it can't be allocated
+	[[nodiscard]] static _table* _acquire() noexcept {
+		for (_table* table = _head.load(std::memory_order_acquire); table != nullptr; table = table->next) {
+			if (table->in_use.load(std::memory_order_relaxed)) continue;
+
+			bool in_use = false;
+			if (table->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire, std::memory_order_relaxed)) return table;
+		}
+
+		_table* fresh = new (std::nothrow) _table{};
+		if (fresh == nullptr) return nullptr;
+
+		fresh->next = _head.load(std::memory_order_relaxed);
+		while (!_head.compare_exchange_weak(fresh->next, fresh, std::memory_order_release, std::memory_order_relaxed)) {}
+		return fresh;
+	}
+
+	/// @returns The table of the calling thread, taken from the pool on first use (`nullptr` if none could be had)
+	[[nodiscard]] static _table* _local() noexcept {
+		thread_local _owner owner {[] {
+			_table* table = _acquire();
+			if (table != nullptr) table->thread.store(_thread_count.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+			return table;
+		}()};
+
+		return owner.table;
+	}
+
+	/// @details Merges the counters of an exiting thread's `table` into `_exited()`, then returns it to the pool
+	/// @note Only counters are cleared, slots keep their site so a reader never sees them rewritten
+	static void _retire(_table& table) noexcept {
+		{
+			const std::lock_guard<std::mutex> lock {_exited_lock};
+
+			for (_slot& slot : table.slots) {
+				const char* file = slot.file.load(std::memory_order_relaxed);
+				const u64_t calls = slot.calls.load(std::memory_order_relaxed);
+				if (file == nullptr || calls == 0) continue;
+
+				_slot* merged = _find(_exited(), file, slot.function, slot.line, slot.column, slot.limit);
+				if (merged == nullptr) {
+					_bump(_exited().dropped, calls);
+					continue;
+				}
+
+				_bump(merged->calls, calls);
+				_bump(merged->fails, slot.fails.load(std::memory_order_relaxed));
+				_raise(merged->peak, slot.peak.load(std::memory_order_relaxed));
+			}
+
+			_bump(_exited().dropped, table.dropped.load(std::memory_order_relaxed));
+		}
+
+		for (_slot& slot : table.slots) {
+			slot.calls.store(0, std::memory_order_relaxed);
+			slot.fails.store(0, std::memory_order_relaxed);
+			slot.peak.store(0, std::memory_order_relaxed);
+		}
+
+		table.dropped.store(0, std::memory_order_relaxed);
+		table.in_use.store(false, std::memory_order_release);
+	}
+
+	/// @returns The slot of the site in `table`, claimed if the site is new, `nullptr` if the table is full
+	/// @warning Single writer per table
+	[[nodiscard]] static _slot* _find(_table& table, const char* file, const char* function,
+		u32_t line, u32_t column, u64_t limit) noexcept {
+		for (u64_t probe = 0, idx = _hash(file, function, line, column); probe < _CAPACITY; ++probe, idx = (idx + 1) % _CAPACITY) {
+			_slot& slot = table.slots[idx];
+			const char* owner = slot.file.load(std::memory_order_relaxed);
+
+			if (owner == nullptr) {
+				slot.function = function;
+				slot.line = line;
+				slot.column = column;
+				slot.limit = limit;
+				slot.file.store(file, std::memory_order_release);
+				return &slot;
+			}
+
+			if (owner == file && slot.line == line && slot.column == column && slot.function == function) return &slot;
+		}
+
+		return nullptr;
+	}
+
+	template <typename F_>
+	static void _visit(const _table& table, u64_t thread, F_& fn) {
+		for (const _slot& slot : table.slots) {
+			const char* file = slot.file.load(std::memory_order_acquire);
+			const u64_t calls = slot.calls.load(std::memory_order_relaxed);
+			if (file == nullptr || calls == 0) continue;
+
+			fn(int_site_stats{
+				file, slot.function, slot.line, slot.column, thread, calls,
+				slot.fails.load(std::memory_order_relaxed),
+				slot.peak.load(std::memory_order_relaxed),
+				slot.limit,
+			});
+		}
+	}
+
+	[[nodiscard]] static u64_t _hash(const char* file, const char* function, u32_t line, u32_t column) noexcept {
+		u64_t hash = reinterpret_cast<u64_t>(file);
+		hash ^= reinterpret_cast<u64_t>(function) ^ (u64_t{line} << 16) ^ column;
+		hash *= 0x9E3779B97F4A7C15ull;
+		return hash >> 54;
+	}
+
+	/// @details Single writer, so plain loads & stores on relaxed atomics are enough
+	static void _bump(std::atomic<u64_t>& counter, u64_t by = 1) noexcept {
+		counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+	}
+
+	/// @details Single writer, raises `counter` to `val` if it's larger
+	static void _raise(std::atomic<u64_t>& counter, u64_t val) noexcept {
+		if (val > counter.load(std::memory_order_relaxed)) counter.store(val, std::memory_order_relaxed);
+	}
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Recording
+
+	/// @details Counts an operation at `site` whose result has magnitude `mag` (of at most `limit`)
+	static void record(const std::source_location& site, bool ok, u64_t mag, u64_t limit) noexcept {
+		_table* table = _local();
+		if (table == nullptr) [[unlikely]] {
+			_unallocated.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		_slot* slot = _find(*table, site.file_name(), site.function_name(), site.line(), site.column(), limit);
+		if (slot == nullptr) {
+			_bump(table->dropped);
+			return;
+		}
+
+		_bump(slot->calls);
+		if (!ok) _bump(slot->fails);
+		_raise(slot->peak, mag);
+	}
+
+#pragma endregion /// Recording
+#pragma region /// Reporting
+
+	/// @details `int_site_stats::thread` of the counters merged from threads which already exited
+	static constexpr u64_t EXITED = U64_MAX;
+
+	/// @details Calls `fn(const int_site_stats&)` for every site of every live thread, then for the merged exited threads
+	/// @note Can run while other threads keep recording or exit, counters are then a near snapshot
+	template <typename F_>
+	static void visit(F_&& fn) {
+		for (_table* table = _head.load(std::memory_order_acquire); table != nullptr; table = table->next) {
+			if (!table->in_use.load(std::memory_order_acquire)) continue;
+			_visit(*table, table->thread.load(std::memory_order_relaxed), fn);
+		}
+
+		const std::lock_guard<std::mutex> lock {_exited_lock};
+		_visit(_exited(), EXITED, fn);
+	}
+
+	/// @details Copies the stats of up to `out.size()` sites (in `visit` order) into `out`
+	/// @returns No.of sites visited, more than `out.size()` if some didn't fit
+	static u64_t snapshot(std::span<int_site_stats> out) {
+		u64_t count = 0;
+		visit([&](const int_site_stats& site) {
+			if (count < out.size()) out[count] = site;
+			++count;
+		});
+
+		return count;
+	}
+
+	/// @returns No.of per-thread tables allocated so far, at most the most threads which recorded at once
+	[[nodiscard]] static u64_t get_table_count() noexcept {
+		u64_t count = 0;
+		for (_table* table = _head.load(std::memory_order_acquire); table != nullptr; table = table->next) ++count;
+		return count;
+	}
+
+	/// @returns No.of operations which found their thread's table full (or missing) and went unrecorded
+	[[nodiscard]] static u64_t get_dropped() noexcept {
+		u64_t total = _unallocated.load(std::memory_order_relaxed) + _exited().dropped.load(std::memory_order_relaxed);
+		for (_table* table = _head.load(std::memory_order_acquire); table != nullptr; table = table->next)
+			total += table->dropped.load(std::memory_order_relaxed);
+		return total;
+	}
+
+	#ifdef _OSTREAM_
+	/// @details Writes one line per site and thread: `file:line:column function calls fails peak/limit`
+	/// @note Needs `<iostream>`, `visit` / `snapshot` read the same counters without it
+	static void dump(std::ostream& os) {
+		visit([&os](const int_site_stats& site) {
+			os << site.file << ':' << site.line << ':' << site.column << ' ' << site.function;
+			if (site.thread == EXITED) os << " [exited threads]";
+			else os << " [thread " << site.thread << ']';
+			os << " calls=" << site.calls << " fails=" << site.fails << " peak=" << site.peak << '/' << site.limit << '\n';
+		});
+	}
+	#endif /// _OSTREAM_
+
+#pragma endregion /// Reporting
+};
+
+} /// namespace xen
+
+#endif /// XEN_INT_TELEMETRY
@@ -0,0 +1,51 @@
+#pragma once
+
+#ifndef XEN_MUL_DIV
+#define XEN_MUL_DIV
+
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_int.hpp"
+#include "err/err.hpp"
+
+namespace xen {
+
+#pragma region /// Fused operations
+
+/// @returns `a * b / c` (truncated), the product is kept in 128 bits
+/// @details `bytes * 1'000'000'000 / ns` only fails if the rate itself doesn't fit `u64_t`
+/// @note Failures are handled by the policy of `a`:
+/// --> `err::NumOverflow`  : The quotient exceeds maximum `u64_t` capacity.
+/// --> `err::DivideByZero` : `c` is zero.
+template <typename P_>
+[[nodiscard]] constexpr safe_int<u64_t, P_> mul_div(safe_int<u64_t, P_> a, u64_t b, u64_t c) noexcept(P_::NOTHROW) {
+	const int_step<u64_t> step = int_ops::mul_div(a.get(), b, c);
+	if (step.ok) [[likely]] return step.val;
+	return P_::on_fail(a.get(), step);
+}
+
+/// @returns `a * b / c` (truncated) for a raw `a`, failures handled like `safe_u64`
+[[nodiscard]] constexpr safe_u64 mul_div(u64_t a, u64_t b, u64_t c) noexcept(safe_u64::policy_type::NOTHROW) {
+	return mul_div(safe_u64{a}, b, c);
+}
+
+/// @returns `a * b + c`, the product is kept in 128 bits
+/// @note Failures are handled by the policy of `a`:
+/// --> `err::NumOverflow` : The result exceeds maximum `u64_t` capacity.
+template <typename P_>
+[[nodiscard]] constexpr safe_int<u64_t, P_> mul_add(safe_int<u64_t, P_> a, u64_t b, u64_t c) noexcept(P_::NOTHROW) {
+	const int_step<u64_t> step = int_ops::mul_add(a.get(), b, c);
+	if (step.ok) [[likely]] return step.val;
+	return P_::on_fail(a.get(), step);
+}
+
+/// @returns `a * b + c` for a raw `a`, failures handled like `safe_u64`
+[[nodiscard]] constexpr safe_u64 mul_add(u64_t a, u64_t b, u64_t c) noexcept(safe_u64::policy_type::NOTHROW) {
+	return mul_add(safe_u64{a}, b, c);
+}
+
+#pragma endregion /// Fused operations
+
+} /// namespace xen
+
+#endif /// XEN_MUL_DIV
@@ -0,0 +1,392 @@
+#pragma once
+
+#ifndef XEN_SAFE_INT
+#define XEN_SAFE_INT
+
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+#include "core/config.hpp"
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "err/err.hpp"
+
+#ifdef XEN_SAFE_INT_TELEMETRY
+#include <source_location>
+
+#include "core/int_telemetry.hpp"
+#endif /// XEN_SAFE_INT_TELEMETRY
+
+namespace xen {
+
+/// @namespace `overflow`
+/// @brief Policies deciding what a `safe_int` does when an operation fails.
+/// @section Policies:
+/// - throw_err   : Throws the `err` (`NumOverflow`, `NumUnderflow`, `DivideByZero`).
+/// - saturate    : Clamps the result to the `T_` limit it went past.
+/// - wrap        : Wraps the result around like the raw integer would (two's complement).
+/// - err_code    : Leaves the value untouched and records the `err` for the calling thread.
+/// - debug_assert: Asserts in debug builds, wraps when `NDEBUG` is defined.
+/// - by_level    : The default, follows `XEN_CHECK_LEVEL` (full: throw_err, debug: debug_assert, none: wrap).
+/// @note Dividing by zero leaves the value untouched for every non-throwing policy
+namespace overflow {
+
+struct throw_err {
+	static constexpr bool NOTHROW = false;
+
+	template <typename T_>
+	[[noreturn]] static constexpr T_ on_fail(T_, const int_step<T_>& step) { throw step.fail; }
+};
+
+struct saturate {
+	static constexpr bool NOTHROW = true;
+
+	template <typename T_>
+	[[nodiscard]] static constexpr T_ on_fail(T_, const int_step<T_>& step) noexcept { return step.bound; }
+};
+
+struct wrap {
+	static constexpr bool NOTHROW = true;
+
+	template <typename T_>
+	[[nodiscard]] static constexpr T_ on_fail(T_, const int_step<T_>& step) noexcept { return step.val; }
+};
+
+struct err_code {
+private:
+	struct _slot {
+		bool is_set {false};
+		err last {err::Logic};
+	};
+
+	[[nodiscard]] static _slot& _local() noexcept {
+		thread_local _slot slot {};
+		return slot;
+	}
+
+public:
+	static constexpr bool NOTHROW = true;
+
+	template <typename T_>
+	[[nodiscard]] static T_ on_fail(T_ cur, const int_step<T_>& step) noexcept {
+		_local() = _slot{true, step.fail};
+		return cur;
+	}
+
+	/// @returns `true` if an operation failed on this thread since the last `clear()`
+	[[nodiscard]] static bool has_err() noexcept { return _local().is_set; }
+
+	/// @returns The most recent failure on this thread
+	[[nodiscard]] static err last_err() noexcept { return _local().last; }
+
+	/// @details Forgets the recorded failure of this thread
+	static void clear() noexcept { _local() = _slot{}; }
+};
+
+struct debug_assert {
+	static constexpr bool NOTHROW = true;
+
+	template <typename T_>
+	[[nodiscard]] static constexpr T_ on_fail(T_, const int_step<T_>& step) noexcept {
+		assert(false && "xen::safe_int: arithmetic overflow");
+		return step.val;
+	}
+};
+
+#if XEN_CHECK_LEVEL == XEN_CHECK_FULL
+typedef throw_err by_level;
+#elif XEN_CHECK_LEVEL == XEN_CHECK_DEBUG
+typedef debug_assert by_level;
+#else
+typedef wrap by_level;
+#endif /// XEN_CHECK_LEVEL
+
+} /// namespace overflow
+
+template <typename T_, typename P_>
+	requires std::is_integral_v<T_>
+class safe_int;
+
+/// @returns `true` if `T_` is a `safe_int`
+template <typename T_> inline constexpr bool is_safe_int_v = false;
+template <typename T_, typename P_> inline constexpr bool is_safe_int_v<safe_int<T_, P_>> = true;
+
+/// @details Any integer type or a `safe_int`
+template <typename T_>
+concept int_operand = std::is_integral_v<T_> || is_safe_int_v<T_>;
+
+/// @returns The integer held by `val` (itself if it already is one)
+template <typename R_>
+	requires int_operand<R_>
+[[nodiscard]] constexpr auto raw_int(R_ val) noexcept {
+	if constexpr (is_safe_int_v<R_>) return val.get();
+	else return val;
+}
+
+#ifdef XEN_SAFE_INT_TELEMETRY
+/// @struct `_site_arg`
+/// @details Operand of a `safe_int` operator, remembering the call site it was converted at
+struct _site_arg {
+	u64_t bits;
+	bool is_signed;
+	std::source_location site;
+
+	template <typename R_>
+		requires int_operand<R_>
+	constexpr _site_arg(R_ val, std::source_location loc = std::source_location::current()) noexcept
+	: bits{static_cast<u64_t>(raw_int(val))}, is_signed{std::is_signed_v<decltype(raw_int(val))>}, site{loc} {}
+
+	/// @returns `fn` applied to the operand in its original signedness
+	template <typename F_>
+	[[nodiscard]] constexpr auto visit(F_ fn) const noexcept {
+		return is_signed ? fn(static_cast<i64_t>(bits)) : fn(bits);
+	}
+};
+
+/// compound operators take the site from their operand, binary ones only from a `safe_int` operand
+/// (a raw integer would tie with the built-in operator through `operator T_`)
+#define XEN_SAFE_INT_OPERAND_TEMPLATE
+#define XEN_SAFE_INT_OPERAND(name) _site_arg name
+#define XEN_SAFE_INT_BINARY_TEMPLATE template <typename R_> requires std::is_integral_v<R_>
+#define XEN_SAFE_INT_SITE_BINARY(op) \
+	friend constexpr safe_int operator op(safe_int lhs, _site_arg rhs) noexcept(_NOTHROW) { lhs op##= rhs; return lhs; }
+#else
+#define XEN_SAFE_INT_OPERAND_TEMPLATE template <typename R_> requires int_operand<R_>
+#define XEN_SAFE_INT_OPERAND(name) R_ name
+#define XEN_SAFE_INT_BINARY_TEMPLATE template <typename R_> requires int_operand<R_>
+#define XEN_SAFE_INT_SITE_BINARY(op)
+#endif /// XEN_SAFE_INT_TELEMETRY
+
+/// @class `safe_int`
+/// @brief A safe wrapper around any integer type of `core/numdef.hpp` (`i8_t` .. `u64_t`).
+/// @section Features:
+/// - Same size as the wrapped integer, no extra state.
+/// - Performs arithmetic operations (+, -, *, /, +=, -=, *=, /=, ++, --) with bounds checking.
+/// - Operands can be any integer type or `safe_int`, results are computed exactly before checking.
+/// - Failures are handled by the compile-time selected policy `P_` (see `overflow`), reported as:
+/// --> `err::NumOverflow`  : Operation result exceeds maximum `T_` capacity.
+/// --> `err::NumUnderflow` : Operation result goes below minimum `T_` capacity.
+/// --> `err::DivideByZero` : Division operation where the divisor is zero.
+/// - Constructing from an out of range integer clamps it into range.
+/// - Can be compared like a regular integer (`==`, `<`, `>`, `!=`, `>=`, `<=`), mixed signedness included.
+template <typename T_, typename P_ = overflow::by_level>
+	requires std::is_integral_v<T_>
+class safe_int {
+private:
+	T_ _val{0};
+
+	static constexpr bool _NOTHROW = P_::NOTHROW;
+
+#pragma region /// Helpers
+
+	/// @returns result of `step`, or what the policy makes of a failed one
+	[[nodiscard]] static constexpr T_ _resolve(T_ cur, const int_step<T_>& step) noexcept(_NOTHROW) {
+		if (step.ok) [[likely]] return step.val;
+		return P_::on_fail(cur, step);
+	}
+
+	/// @returns `op` applied to the raw integer of `operand`, recorded per call site in telemetry builds
+	template <typename R_, typename F_>
+	[[nodiscard]] static constexpr int_step<T_> _step(const R_& operand, F_ op) noexcept {
+		#ifdef XEN_SAFE_INT_TELEMETRY
+		const int_step<T_> step = operand.visit(op);
+		if (!std::is_constant_evaluated()) {
+			const T_ res = step.ok ? step.val : step.bound;
+			int_telemetry::record(operand.site, step.ok, int_ops::_to_wide(res).mag,
+				int_ops::_to_wide(std::numeric_limits<T_>::max()).mag);
+		}
+
+		return step;
+		#else
+		return op(raw_int(operand));
+		#endif /// XEN_SAFE_INT_TELEMETRY
+	}
+
+	/// @returns `val` as an operand of `_step`
+	template <typename R_>
+	[[nodiscard]] static constexpr auto _operand(R_ val) noexcept {
+		#ifdef XEN_SAFE_INT_TELEMETRY
+		return _site_arg{val};
+		#else
+		return val;
+		#endif /// XEN_SAFE_INT_TELEMETRY
+	}
+
+#pragma endregion /// Helpers
+
+public:
+	typedef T_ value_type;
+	typedef P_ policy_type;
+
+#pragma region /// Constructors
+
+	[[nodiscard]] constexpr safe_int() noexcept = default;
+
+	template <typename R_>
+		requires std::is_integral_v<R_>
+	[[nodiscard]] constexpr safe_int(R_ val) noexcept : _val{int_ops::clamp<T_>(val)} {}
+
+	[[nodiscard]] constexpr operator T_() const noexcept { return _val; }
+
+	/// @returns The wrapped integer
+	[[nodiscard]] constexpr T_ get() const noexcept { return _val; }
+
+#pragma endregion /// Constructors
+#pragma region /// (+) operation
+
+	friend constexpr safe_int& operator++(safe_int& self) noexcept(_NOTHROW) {
+		self._val = _resolve(self._val, _step(_operand(1), [&](auto one) { return int_ops::add<T_>(self._val, one); }));
+		return self;
+	}
+
+	friend constexpr safe_int operator++(safe_int& self, int) noexcept(_NOTHROW) {
+		safe_int tmp{self};
+		++self;
+		return tmp;
+	}
+
+	XEN_SAFE_INT_OPERAND_TEMPLATE
+	friend constexpr safe_int& operator+=(safe_int& lhs, XEN_SAFE_INT_OPERAND(rhs)) noexcept(_NOTHROW) {
+		lhs._val = _resolve(lhs._val, _step(rhs, [&](auto raw) { return int_ops::add<T_>(lhs._val, raw); }));
+		return lhs;
+	}
+
+	XEN_SAFE_INT_BINARY_TEMPLATE
+	friend constexpr safe_int operator+(safe_int lhs, R_ rhs) noexcept(_NOTHROW) {
+		lhs += rhs;
+		return lhs;
+	}
+
+	XEN_SAFE_INT_SITE_BINARY(+)
+
+	template <typename R_>
+		requires std::is_integral_v<R_>
+	friend constexpr safe_int operator+(R_ lhs, safe_int rhs) noexcept(_NOTHROW) {
+		rhs += lhs;
+		return rhs;
+	}
+
+#pragma endregion /// (+) operation
+#pragma region /// (-) operation
+
+	friend constexpr safe_int& operator--(safe_int& self) noexcept(_NOTHROW) {
+		self._val = _resolve(self._val, _step(_operand(1), [&](auto one) { return int_ops::sub<T_>(self._val, one); }));
+		return self;
+	}
+
+	friend constexpr safe_int operator--(safe_int& self, int) noexcept(_NOTHROW) {
+		safe_int tmp{self};
+		--self;
+		return tmp;
+	}
+
+	XEN_SAFE_INT_OPERAND_TEMPLATE
+	friend constexpr safe_int& operator-=(safe_int& lhs, XEN_SAFE_INT_OPERAND(rhs)) noexcept(_NOTHROW) {
+		lhs._val = _resolve(lhs._val, _step(rhs, [&](auto raw) { return int_ops::sub<T_>(lhs._val, raw); }));
+		return lhs;
+	}
+
+	XEN_SAFE_INT_BINARY_TEMPLATE
+	friend constexpr safe_int operator-(safe_int lhs, R_ rhs) noexcept(_NOTHROW) {
+		lhs -= rhs;
+		return lhs;
+	}
+
+	XEN_SAFE_INT_SITE_BINARY(-)
+
+	template <typename R_>
+		requires std::is_integral_v<R_>
+	friend constexpr safe_int operator-(R_ lhs, safe_int rhs) noexcept(_NOTHROW) {
+		safe_int res;
+		res._val = _resolve(int_ops::clamp<T_>(lhs), _step(_operand(lhs), [&](auto raw) { return int_ops::sub<T_>(raw, rhs._val); }));
+		return res;
+	}
+
+#pragma endregion /// (-) operation
+#pragma region /// (*) operation
+
+	XEN_SAFE_INT_OPERAND_TEMPLATE
+	friend constexpr safe_int& operator*=(safe_int& lhs, XEN_SAFE_INT_OPERAND(rhs)) noexcept(_NOTHROW) {
+		lhs._val = _resolve(lhs._val, _step(rhs, [&](auto raw) { return int_ops::mul<T_>(lhs._val, raw); }));
+		return lhs;
+	}
+
+	XEN_SAFE_INT_BINARY_TEMPLATE
+	friend constexpr safe_int operator*(safe_int lhs, R_ rhs) noexcept(_NOTHROW) {
+		lhs *= rhs;
+		return lhs;
+	}
+
+	XEN_SAFE_INT_SITE_BINARY(*)
+
+	template <typename R_>
+		requires std::is_integral_v<R_>
+	friend constexpr safe_int operator*(R_ lhs, safe_int rhs) noexcept(_NOTHROW) {
+		rhs *= lhs;
+		return rhs;
+	}
+
+#pragma endregion /// (*) operation
+#pragma region /// (/) operation
+
+	XEN_SAFE_INT_OPERAND_TEMPLATE
+	friend constexpr safe_int& operator/=(safe_int& lhs, XEN_SAFE_INT_OPERAND(rhs)) noexcept(_NOTHROW) {
+		lhs._val = _resolve(lhs._val, _step(rhs, [&](auto raw) { return int_ops::div<T_>(lhs._val, raw); }));
+		return lhs;
+	}
+
+	XEN_SAFE_INT_BINARY_TEMPLATE
+	friend constexpr safe_int operator/(safe_int lhs, R_ rhs) noexcept(_NOTHROW) {
+		lhs /= rhs;
+		return lhs;
+	}
+
+	XEN_SAFE_INT_SITE_BINARY(/)
+
+	template <typename R_>
+		requires std::is_integral_v<R_>
+	friend constexpr safe_int operator/(R_ lhs, safe_int rhs) noexcept(_NOTHROW) {
+		safe_int res;
+		res._val = _resolve(int_ops::clamp<T_>(lhs), _step(_operand(lhs), [&](auto raw) { return int_ops::div<T_>(raw, rhs._val); }));
+		return res;
+	}
+
+#pragma endregion /// (/) operation
+#pragma region /// Comparison overload
+
+	#define XEN_SAFE_INT_COMPARISON_OP(op, cmp) \
+		template <typename R_> requires int_operand<R_> \
+		friend constexpr bool operator op(const safe_int& lhs, R_ rhs) noexcept { return cmp(lhs._val, raw_int(rhs)); } \
+		template <typename R_> requires std::is_integral_v<R_> \
+		friend constexpr bool operator op(R_ lhs, const safe_int& rhs) noexcept { return cmp(lhs, rhs._val); } \
+
+	XEN_SAFE_INT_COMPARISON_OP(==, std::cmp_equal)
+	XEN_SAFE_INT_COMPARISON_OP(!=, std::cmp_not_equal)
+	XEN_SAFE_INT_COMPARISON_OP(<, std::cmp_less)
+	XEN_SAFE_INT_COMPARISON_OP(>, std::cmp_greater)
+	XEN_SAFE_INT_COMPARISON_OP(<=, std::cmp_less_equal)
+	XEN_SAFE_INT_COMPARISON_OP(>=, std::cmp_greater_equal)
+
+	#undef XEN_SAFE_INT_COMPARISON_OP
+	#undef XEN_SAFE_INT_OPERAND_TEMPLATE
+	#undef XEN_SAFE_INT_OPERAND
+	#undef XEN_SAFE_INT_BINARY_TEMPLATE
+	#undef XEN_SAFE_INT_SITE_BINARY
+
+#pragma endregion /// Comparison overload
+};
+
+typedef safe_int<i8_t>  safe_i8;
+typedef safe_int<i16_t> safe_i16;
+typedef safe_int<i32_t> safe_i32;
+typedef safe_int<i64_t> safe_i64;
+
+typedef safe_int<u8_t>  safe_u8;
+typedef safe_int<u16_t> safe_u16;
+typedef safe_int<u32_t> safe_u32;
+typedef safe_int<u64_t> safe_u64;
+
+} /// namespace xen
+
+#endif /// XEN_SAFE_INT
@@ -0,0 +1,318 @@
+#pragma once
+
+#ifndef XEN_SAFE_UINT
+#define XEN_SAFE_UINT
+
+#include <compare>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define XEN_SAFE_UINT_ADC
+#endif /// __x86_64__ || _M_X64
+
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+
+namespace xen {
+
+/// @class `safe_uint`
+/// @brief A fixed-width unsigned integer of `LIMBS_` 64-bit limbs, checked like `safe_u64`.
+/// @section Features:
+/// - Little-endian limbs, no extra state (`safe_u128` is 16 bytes, `safe_u256` is 32 bytes).
+/// - Performs arithmetic operations (+, -, *, /, +=, -=, *=, /=, ++, --) with bounds checking:
+/// --> `err::NumOverflow`  : Operation result exceeds maximum capacity.
+/// --> `err::NumUnderflow` : Operation result goes below zero.
+/// --> `err::DivideByZero` : Division operation where the divisor is zero.
+/// - Add / subtract run as add-with-carry chains (`adc` / `sbb` on x86-64),
+///   multiplication as a schoolbook of 64x64->128 widening multiplies.
+/// - Narrower `safe_uint` and integers convert implicitly, a negative integer clamps to `0` like `safe_int`.
+/// - Narrowing (to a narrower `safe_uint` or `safe_u64`) is explicit and throws `err::NumOverflow` if lossy.
+/// - Can be compared like a regular integer (`==`, `<`, `>`, `!=`, `>=`, `<=`).
+template <u64_t LIMBS_>
+	requires (LIMBS_ >= 2)
+class safe_uint {
+private:
+	template <u64_t L_>
+		requires (L_ >= 2)
+	friend class safe_uint;
+
+	u64_t _limbs[LIMBS_] {};
+
+#pragma region /// Helpers
+
+	/// @returns `a + b + carry`, `carry` set to the carry out
+	[[nodiscard]] static constexpr u64_t _adc(u64_t a, u64_t b, u8_t& carry) noexcept {
+		#ifdef XEN_SAFE_UINT_ADC
+		if (!std::is_constant_evaluated()) {
+			unsigned long long res;
+			carry = _addcarry_u64(carry, a, b, &res);
+			return res;
+		}
+		#endif /// XEN_SAFE_UINT_ADC
+
+		const u64_t sum = a + b;
+		const u64_t res = sum + carry;
+		carry = (sum < a) | (res < sum);
+		return res;
+	}
+
+	/// @returns `a - b - borrow`, `borrow` set to the borrow out
+	[[nodiscard]] static constexpr u64_t _sbb(u64_t a, u64_t b, u8_t& borrow) noexcept {
+		#ifdef XEN_SAFE_UINT_ADC
+		if (!std::is_constant_evaluated()) {
+			unsigned long long res;
+			borrow = _subborrow_u64(borrow, a, b, &res);
+			return res;
+		}
+		#endif /// XEN_SAFE_UINT_ADC
+
+		const u64_t diff = a - b;
+		const u64_t res = diff - borrow;
+		borrow = (a < b) | (diff < borrow);
+		return res;
+	}
+
+	/// @returns The index of the highest non-zero limb + 1 (`0` if the value is zero)
+	[[nodiscard]] constexpr u64_t _used() const noexcept {
+		u64_t used = LIMBS_;
+		while (used > 0 && _limbs[used - 1] == 0) --used;
+		return used;
+	}
+
+	[[nodiscard]] constexpr bool _bit(u64_t i) const noexcept { return (_limbs[i / 64] >> (i % 64)) & 1; }
+
+	constexpr void _shl1() noexcept {
+		for (u64_t i = LIMBS_ - 1; i > 0; --i) _limbs[i] = (_limbs[i] << 1) | (_limbs[i - 1] >> 63);
+		_limbs[0] <<= 1;
+	}
+
+	/// @returns `*this += rhs` wrapped, `true` if it carried out
+	constexpr bool _add(const safe_uint& rhs) noexcept {
+		u8_t carry = 0;
+		for (u64_t i = 0; i < LIMBS_; ++i) _limbs[i] = _adc(_limbs[i], rhs._limbs[i], carry);
+		return carry;
+	}
+
+	/// @returns `*this -= rhs` wrapped, `true` if it borrowed
+	constexpr bool _sub(const safe_uint& rhs) noexcept {
+		u8_t borrow = 0;
+		for (u64_t i = 0; i < LIMBS_; ++i) _limbs[i] = _sbb(_limbs[i], rhs._limbs[i], borrow);
+		return borrow;
+	}
+
+	/// @returns `*this / rhs`, `rem` set to the remainder
+	[[nodiscard]] constexpr safe_uint _divmod(const safe_uint& rhs, safe_uint& rem) const {
+		const u64_t rhs_used = rhs._used();
+		if (rhs_used == 0) [[unlikely]] throw err::DivideByZero;
+
+		safe_uint quot;
+		rem = safe_uint{};
+
+		if (rhs_used == 1) {
+			/// single limb divisor, one 128/64 division per limb
+			u64_t carry = 0;
+			for (u64_t i = _used(); i-- > 0;) quot._limbs[i] = int_ops::_div_wide(carry, _limbs[i], rhs._limbs[0], carry);
+			rem._limbs[0] = carry;
+			return quot;
+		}
+
+		/// restoring long division, one quotient bit per bit of `*this`
+		for (u64_t i = _used() * 64; i-- > 0;) {
+			const bool top = rem._limbs[LIMBS_ - 1] >> 63;
+			rem._shl1();
+			rem._limbs[0] |= _bit(i);
+
+			if (top || rem >= rhs) {
+				(void)rem._sub(rhs);
+				quot._limbs[i / 64] |= u64_t{1} << (i % 64);
+			}
+		}
+
+		return quot;
+	}
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Constructors
+
+	[[nodiscard]] constexpr safe_uint() noexcept = default;
+
+	template <typename R_>
+		requires std::is_integral_v<R_>
+	[[nodiscard]] constexpr safe_uint(R_ val) noexcept : _limbs{int_ops::clamp<u64_t>(val)} {}
+
+	[[nodiscard]] constexpr safe_uint(safe_u64 val) noexcept : _limbs{val.get()} {}
+
+	template <u64_t L_>
+	[[nodiscard]] constexpr explicit(L_ > LIMBS_) safe_uint(const safe_uint<L_>& val) noexcept(L_ <= LIMBS_) {
+		if constexpr (L_ > LIMBS_) {
+			for (u64_t i = LIMBS_; i < L_; ++i) if (val._limbs[i] != 0) throw err::NumOverflow;
+		}
+
+		for (u64_t i = 0; i < L_ && i < LIMBS_; ++i) _limbs[i] = val._limbs[i];
+	}
+
+	/// @returns A `safe_uint` of the given limbs (least significant first)
+	[[nodiscard]] static constexpr safe_uint from_limbs(const u64_t (&limbs)[LIMBS_]) noexcept {
+		safe_uint res;
+		for (u64_t i = 0; i < LIMBS_; ++i) res._limbs[i] = limbs[i];
+		return res;
+	}
+
+	/// @returns The value as `safe_u64`, throws `err::NumOverflow` if it doesn't fit
+	[[nodiscard]] constexpr safe_u64 to_u64() const {
+		if (_used() > 1) [[unlikely]] throw err::NumOverflow;
+		return _limbs[0];
+	}
+
+	[[nodiscard]] constexpr explicit operator safe_u64() const { return to_u64(); }
+
+	/// @returns Limb `i` (least significant first)
+	[[nodiscard]] constexpr u64_t get_limb(u64_t i) const {
+		if (i >= LIMBS_) throw err::IndexOutOfRange;
+		return _limbs[i];
+	}
+
+	/// @returns The maximum representable value
+	[[nodiscard]] static constexpr safe_uint max() noexcept {
+		safe_uint res;
+		for (u64_t& limb : res._limbs) limb = U64_MAX;
+		return res;
+	}
+
+#pragma endregion /// Constructors
+#pragma region /// (+) operation
+
+	friend constexpr safe_uint& operator++(safe_uint& self) {
+		self += safe_uint{1};
+		return self;
+	}
+
+	friend constexpr safe_uint operator++(safe_uint& self, int) {
+		safe_uint tmp{self};
+		++self;
+		return tmp;
+	}
+
+	friend constexpr safe_uint& operator+=(safe_uint& lhs, const safe_uint& rhs) {
+		safe_uint res{lhs};
+		if (res._add(rhs)) [[unlikely]] throw err::NumOverflow;
+		lhs = res;
+		return lhs;
+	}
+
+	friend constexpr safe_uint operator+(safe_uint lhs, const safe_uint& rhs) { return lhs += rhs; }
+
+#pragma endregion /// (+) operation
+#pragma region /// (-) operation
+
+	friend constexpr safe_uint& operator--(safe_uint& self) {
+		self -= safe_uint{1};
+		return self;
+	}
+
+	friend constexpr safe_uint operator--(safe_uint& self, int) {
+		safe_uint tmp{self};
+		--self;
+		return tmp;
+	}
+
+	friend constexpr safe_uint& operator-=(safe_uint& lhs, const safe_uint& rhs) {
+		safe_uint res{lhs};
+		if (res._sub(rhs)) [[unlikely]] throw err::NumUnderflow;
+		lhs = res;
+		return lhs;
+	}
+
+	friend constexpr safe_uint operator-(safe_uint lhs, const safe_uint& rhs) { return lhs -= rhs; }
+
+#pragma endregion /// (-) operation
+#pragma region /// (*) operation
+
+	friend constexpr safe_uint operator*(const safe_uint& lhs, const safe_uint& rhs) {
+		const u64_t lhs_used = lhs._used();
+		const u64_t rhs_used = rhs._used();
+		if (lhs_used == 0 || rhs_used == 0) return safe_uint{};
+		if (lhs_used + rhs_used > LIMBS_ + 1) [[unlikely]] throw err::NumOverflow;
+
+		safe_uint res;
+		for (u64_t i = 0; i < lhs_used; ++i) {
+			u64_t carry = 0;
+
+			for (u64_t j = 0; j < rhs_used; ++j) {
+				u64_t hi = 0;
+				const u64_t lo = int_ops::_mul_wide(lhs._limbs[i], rhs._limbs[j], hi);
+
+				/// `hi:lo + carry + res` fits 128 bits, so neither carry below can wrap `hi`
+				u8_t c = 0;
+				const u64_t sum = _adc(lo, carry, c);
+				hi += c;
+				c = 0;
+
+				if (i + j >= LIMBS_) {
+					if (sum != 0 || hi != 0) [[unlikely]] throw err::NumOverflow;
+					carry = 0;
+					continue;
+				}
+
+				res._limbs[i + j] = _adc(res._limbs[i + j], sum, c);
+				carry = hi + c;
+			}
+
+			if (carry != 0) {
+				if (i + rhs_used >= LIMBS_) [[unlikely]] throw err::NumOverflow;
+				res._limbs[i + rhs_used] = carry;
+			}
+		}
+
+		return res;
+	}
+
+	friend constexpr safe_uint& operator*=(safe_uint& lhs, const safe_uint& rhs) { return lhs = lhs * rhs; }
+
+#pragma endregion /// (*) operation
+#pragma region /// (/) operation
+
+	friend constexpr safe_uint operator/(const safe_uint& lhs, const safe_uint& rhs) {
+		safe_uint rem;
+		return lhs._divmod(rhs, rem);
+	}
+
+	friend constexpr safe_uint operator%(const safe_uint& lhs, const safe_uint& rhs) {
+		safe_uint rem;
+		(void)lhs._divmod(rhs, rem);
+		return rem;
+	}
+
+	friend constexpr safe_uint& operator/=(safe_uint& lhs, const safe_uint& rhs) { return lhs = lhs / rhs; }
+	friend constexpr safe_uint& operator%=(safe_uint& lhs, const safe_uint& rhs) { return lhs = lhs % rhs; }
+
+#pragma endregion /// (/) operation
+#pragma region /// Comparison overload
+
+	friend constexpr bool operator==(const safe_uint& lhs, const safe_uint& rhs) noexcept {
+		for (u64_t i = 0; i < LIMBS_; ++i) if (lhs._limbs[i] != rhs._limbs[i]) return false;
+		return true;
+	}
+
+	friend constexpr std::strong_ordering operator<=>(const safe_uint& lhs, const safe_uint& rhs) noexcept {
+		for (u64_t i = LIMBS_; i-- > 0;) {
+			if (lhs._limbs[i] != rhs._limbs[i]) return lhs._limbs[i] <=> rhs._limbs[i];
+		}
+
+		return std::strong_ordering::equal;
+	}
+
+#pragma endregion /// Comparison overload
+};
+
+typedef safe_uint<2> safe_u128;
+typedef safe_uint<4> safe_u256;
+
+} /// namespace xen
+
+#endif /// XEN_SAFE_UINT
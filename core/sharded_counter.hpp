@@ -0,0 +1,117 @@
+#pragma once
+
+#ifndef XEN_SHARDED_COUNTER
+#define XEN_SHARDED_COUNTER
+
+#include <atomic>
+
+#include "core/atomic_safe_u64.hpp"
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+
+namespace xen {
+
+/// @namespace `_shard`
+namespace _shard {
+
+/// @details Assumed cache line size, shards are padded to it so they never share a line
+inline constexpr u64_t CACHE_LINE = 64;
+
+/// @returns A small per-thread index, threads are numbered round-robin on first use
+[[nodiscard]] inline u64_t thread_index() noexcept {
+	static std::atomic<u64_t> next {0};
+	thread_local const u64_t index = next.fetch_add(1, std::memory_order_relaxed);
+	return index;
+}
+
+} /// namespace _shard
+
+/// @class `sharded_counter`
+/// @brief A statistics counter split into `SHARDS_` cache-line padded `atomic_safe_u64` shards.
+/// @section Features:
+/// - Each thread bumps its own shard with a relaxed atomic add, so no cache line bounces between cores.
+/// - Threads beyond `SHARDS_` share shards round-robin, still correct, just contended.
+/// - `read_approx()` sums the shards with relaxed loads and never throws, saturating at `U64_MAX`.
+/// - `read_exact()` sums the shards with acquire loads, checked at every `XEN_CHECK_LEVEL`.
+/// - Failures throw at every `XEN_CHECK_LEVEL`:
+/// --> `err::NumOverflow` : A shard, or the sum of all shards exceeds maximum `u64_t` capacity.
+/// @note `read_exact()` is exact for every `add` which happened-before it (e.g. joined writers),
+/// concurrent `add`s may or may not be counted
+template <u64_t SHARDS_ = 64>
+	requires (SHARDS_ > 0 && (SHARDS_ & (SHARDS_ - 1)) == 0)
+class sharded_counter {
+private:
+	struct alignas(_shard::CACHE_LINE) _padded {
+		atomic_safe_u64 val {};
+	};
+
+	_padded _shards[SHARDS_] {};
+
+	[[nodiscard]] static u64_t _local() noexcept { return _shard::thread_index() & (SHARDS_ - 1); }
+
+public:
+#pragma region /// Constructors
+
+	[[nodiscard]] sharded_counter() noexcept = default;
+
+	sharded_counter(const sharded_counter&) = delete;
+	sharded_counter& operator=(const sharded_counter&) = delete;
+
+#pragma endregion /// Constructors
+#pragma region /// Operations
+
+	/// @details Adds `val` to the shard of the calling thread
+	void add(safe_u64 val) { _shards[_local()].val.fetch_add(val, std::memory_order_relaxed); }
+
+	sharded_counter& operator++() {
+		add(1);
+		return *this;
+	}
+
+	sharded_counter& operator+=(safe_u64 val) {
+		add(val);
+		return *this;
+	}
+
+	/// @details Sets every shard back to `0`
+	/// @warning Concurrent `add`s may be lost
+	void reset() noexcept {
+		for (_padded& shard : _shards) shard.val.store(0, std::memory_order_relaxed);
+	}
+
+#pragma endregion /// Operations
+#pragma region /// Getters
+
+	/// @returns The sum of every shard, a cheap snapshot which may miss concurrent `add`s
+	[[nodiscard]] safe_u64 read_approx() const noexcept {
+		u64_t total = 0;
+		for (const _padded& shard : _shards) {
+			const int_step<u64_t> step = int_ops::add<u64_t>(total, shard.val.load(std::memory_order_relaxed).get());
+			total = step.ok ? step.val : step.bound;
+		}
+
+		return total;
+	}
+
+	/// @returns The sum of every shard
+	[[nodiscard]] safe_u64 read_exact() const {
+		u64_t total = 0;
+		for (const _padded& shard : _shards) {
+			const int_step<u64_t> next = int_ops::add<u64_t>(total, shard.val.load(std::memory_order_acquire).get());
+			if (!next.ok) [[unlikely]] throw err::NumOverflow;
+			total = next.val;
+		}
+
+		return safe_u64{total};
+	}
+
+	/// @returns The no.of shards
+	[[nodiscard]] static constexpr u64_t get_shard_count() noexcept { return SHARDS_; }
+
+#pragma endregion /// Getters
+};
+
+} /// namespace xen
+
+#endif /// XEN_SHARDED_COUNTER
@@ -0,0 +1,216 @@
+#pragma once
+
+#ifndef XEN_VARINT
+#define XEN_VARINT
+
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif /// __SSE2__
+
+#include "core/int_ops.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+
+namespace xen {
+
+/// @class `varint`
+/// @brief LEB128 (protobuf style) variable length encoding of integers, 7 bits per byte.
+/// @section Features:
+/// - Works on every `core/numdef.hpp` integer type and `safe_int`, small values take a single byte.
+/// - Signed integers are zigzag mapped first (`-1` -> `1`, `1` -> `2`), so small negatives stay small.
+/// - Encodes / decodes straight into caller provided buffers, nothing is allocated.
+/// - Bulk `u64_t` decoding takes 16 single-byte varints per SSE2 step (the common small-integer case)
+///   and finds varint ends through the continuation bit mask otherwise.
+/// - Reports errors via the `err` enumeration:
+/// --> `err::NumOverflow`     : Malformed input, a varint longer than 10 bytes or past the range of the target type.
+/// --> `err::IndexOutOfRange` : Input ends in the middle of a varint, or the output buffer is too small.
+class varint {
+private:
+	static constexpr u8_t _MORE = 0x80;
+	static constexpr u8_t _BITS = 0x7F;
+
+#pragma region /// Helpers
+
+	/// @returns The varint of `in` starting at `pos` (advanced past it), throws on malformed / truncated input
+	[[nodiscard]] static constexpr u64_t _read(std::span<const u8_t> in, u64_t& pos) {
+		u64_t val = 0;
+
+		for (u64_t shift = 0; shift < 64; shift += 7) {
+			if (pos >= in.size()) [[unlikely]] throw err::IndexOutOfRange;
+
+			const u8_t byte = in[pos++];
+			const u64_t bits = byte & _BITS;
+
+			/// the 10th byte only has room for the top bit of a `u64_t`
+			if (shift == 63 && (bits > 1 || (byte & _MORE))) [[unlikely]] throw err::NumOverflow;
+
+			val |= bits << shift;
+			if (!(byte & _MORE)) return val;
+		}
+
+		throw err::NumOverflow;
+	}
+
+	/// @returns Bytes written by encoding `val` at `out[pos..]`
+	[[nodiscard]] static constexpr u64_t _write(u64_t val, std::span<u8_t> out, u64_t pos) {
+		const u64_t len = encoded_len(val);
+		if (out.size() < pos || out.size() - pos < len) [[unlikely]] throw err::IndexOutOfRange;
+
+		for (; val > _BITS; val >>= 7) out[pos++] = static_cast<u8_t>(val | _MORE);
+		out[pos] = static_cast<u8_t>(val);
+		return len;
+	}
+
+	template <typename T_>
+	[[nodiscard]] static constexpr u64_t _to_bits(T_ val) noexcept {
+		const auto raw = raw_int(val);
+		if constexpr (std::is_signed_v<decltype(raw)>) return zigzag_encode(raw);
+		else return static_cast<u64_t>(raw);
+	}
+
+#pragma endregion /// Helpers
+
+public:
+	/// @details Longest possible encoding of a `u64_t`
+	static constexpr u64_t MAX_LEN = 10;
+
+#pragma region /// Zigzag
+
+	/// @returns `val` mapped to `u64_t` so that small magnitudes stay small (`0, -1, 1, -2` -> `0, 1, 2, 3`)
+	[[nodiscard]] static constexpr u64_t zigzag_encode(i64_t val) noexcept {
+		return (static_cast<u64_t>(val) << 1) ^ static_cast<u64_t>(val < 0 ? -1 : 0);
+	}
+
+	/// @returns Inverse of `zigzag_encode`
+	[[nodiscard]] static constexpr i64_t zigzag_decode(u64_t val) noexcept {
+		return static_cast<i64_t>((val >> 1) ^ (u64_t{0} - (val & 1)));
+	}
+
+#pragma endregion /// Zigzag
+#pragma region /// Single value
+
+	/// @returns No.of bytes `val` encodes to (after zigzag mapping for signed types)
+	template <typename T_>
+		requires int_operand<T_>
+	[[nodiscard]] static constexpr u64_t encoded_len(T_ val) noexcept {
+		u64_t bits = _to_bits(val);
+		u64_t len = 1;
+		while (bits > _BITS) {
+			bits >>= 7;
+			++len;
+		}
+
+		return len;
+	}
+
+	/// @returns No.of bytes written to the front of `out`
+	template <typename T_>
+		requires int_operand<T_>
+	static constexpr u64_t encode(T_ val, std::span<u8_t> out) { return _write(_to_bits(val), out, 0); }
+
+	/// @returns No.of bytes consumed from the front of `in`, `val` set to the decoded value
+	template <typename T_>
+		requires int_operand<T_>
+	static constexpr u64_t decode(std::span<const u8_t> in, T_& val) {
+		if constexpr (is_safe_int_v<T_>) {
+			typename T_::value_type raw {};
+			const u64_t len = decode(in, raw);
+			val = raw;
+			return len;
+		} else {
+			u64_t pos = 0;
+			const u64_t bits = _read(in, pos);
+
+			if constexpr (std::is_signed_v<T_>) {
+				const i64_t wide = zigzag_decode(bits);
+				if (wide > std::numeric_limits<T_>::max() || wide < std::numeric_limits<T_>::min()) [[unlikely]]
+					throw err::NumOverflow;
+				val = static_cast<T_>(wide);
+			} else {
+				if (bits > std::numeric_limits<T_>::max()) [[unlikely]] throw err::NumOverflow;
+				val = static_cast<T_>(bits);
+			}
+
+			return pos;
+		}
+	}
+
+#pragma endregion /// Single value
+#pragma region /// Bulk
+
+	/// @returns No.of bytes written to `out` by encoding every value of `in` back to back
+	static u64_t encode(std::span<const u64_t> in, std::span<u8_t> out) {
+		u64_t pos = 0;
+		for (const u64_t val : in) pos += _write(val, out, pos);
+		return pos;
+	}
+
+	/// @returns No.of bytes consumed from `in` to fill every element of `out`
+	static u64_t decode(std::span<const u8_t> in, std::span<u64_t> out) {
+		u64_t pos = 0;
+		u64_t i = 0;
+
+		#ifdef __SSE2__
+		const __m128i zero = _mm_setzero_si128();
+
+		while (out.size() - i >= 16 && in.size() - pos >= 16) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.data() + pos));
+			const u32_t more = static_cast<u32_t>(_mm_movemask_epi8(chunk));
+
+			if (more == 0) {
+				/// 16 single-byte varints, widen u8 -> u64 by unpacking against zero
+				const __m128i lo16 = _mm_unpacklo_epi8(chunk, zero);
+				const __m128i hi16 = _mm_unpackhi_epi8(chunk, zero);
+				const __m128i parts[4] {
+					_mm_unpacklo_epi16(lo16, zero), _mm_unpackhi_epi16(lo16, zero),
+					_mm_unpacklo_epi16(hi16, zero), _mm_unpackhi_epi16(hi16, zero),
+				};
+
+				for (u64_t k = 0; k < 4; ++k) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i + k * 4), _mm_unpacklo_epi32(parts[k], zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i + k * 4 + 2), _mm_unpackhi_epi32(parts[k], zero));
+				}
+
+				i += 16;
+				pos += 16;
+				continue;
+			}
+
+			/// every varint ending inside the chunk, its length read off the continuation mask
+			u64_t used = 0;
+			while (used < 16) {
+				const u32_t rest = ~more >> used;
+				if ((rest & 0xFFFF >> used) == 0) break;
+
+				const u64_t len = static_cast<u64_t>(__builtin_ctz(rest)) + 1;
+				if (len > MAX_LEN) break;
+
+				u64_t val = 0;
+				for (u64_t b = 0; b < len; ++b) val |= static_cast<u64_t>(in[pos + used + b] & _BITS) << (7 * b);
+				if (len == MAX_LEN && in[pos + used + len - 1] > 1) [[unlikely]] throw err::NumOverflow;
+
+				out[i++] = val;
+				used += len;
+			}
+
+			/// a varint spanning past the chunk (or too long) goes through the scalar path
+			if (used == 0) out[i++] = _read(in, pos);
+			pos += used;
+		}
+		#endif /// __SSE2__
+
+		for (; i < out.size(); ++i) out[i] = _read(in, pos);
+		return pos;
+	}
+
+#pragma endregion /// Bulk
+};
+
+} /// namespace xen
+
+#endif /// XEN_VARINT
@@ -5,26 +5,143 @@
 
 #include "core/numdef.hpp"
 
+/// @details Every `err` variant as `X(name, severity, category, description)`,
+/// the enumeration and all of its tables below are generated from this list
+#define XEN_ERR_LIST(X) \
+	X(Logic,           Fatal,   Logic,    "The program logic does not match the expected logic.") \
+	X(IndexOutOfRange, Error,   Argument, "Attempt to access outside the bounds of an array or container.") \
+	X(InvalidArgument, Error,   Argument, "A function received an unsupported or invalid argument.") \
+	X(NumOverflow,     Error,   Numeric,  "A numeric value exceeded the maximum representable capacity.") \
+	X(NumUnderflow,    Error,   Numeric,  "A numeric value went below the minimum representable capacity.") \
+	X(DivideByZero,    Error,   Numeric,  "Trying to divide numeric by 0.") \
+	X(IoFailure,       Warning, Io,       "A file or operating system request failed.")
+
 namespace xen {
 
 /// @enum `err`
 /// @brief Represents different categories of runtime errors.
-/// @section Variants:
-/// - Logic          : The program logic does not match the expected logic.
-/// - IndexOutOfRange: Attempt to access outside the bounds of an array or container.
-/// - InvalidArgument: A function received an unsupported or invalid argument.
-/// - NumOverflow    : A numeric value exceeded the maximum representable capacity.
-/// - NumUnderflow   : A numeric value went below the minimum representable capacity.
-/// - DivideByZero   : Trying to divide numeric by 0.
+/// @section Variants: see `XEN_ERR_LIST` (or `get_err_info(type).desc`)
 enum class err: u8_t {
-	Logic,
-	IndexOutOfRange,
-	InvalidArgument,
-	NumOverflow,
-	NumUnderflow,
-	DivideByZero,
+	#define XEN_ERR_ENUM(name, severity, category, desc) name,
+	XEN_ERR_LIST(XEN_ERR_ENUM)
+	#undef XEN_ERR_ENUM
+};
+
+/// @enum `err_severity`
+/// @brief How bad an `err` usually is.
+/// @section Variants:
+/// - Warning : Recoverable, retrying may succeed.
+/// - Error   : The operation failed, the program can go on.
+/// - Fatal   : The program state can no longer be trusted.
+enum class err_severity: u8_t { Warning, Error, Fatal };
+
+/// @enum `err_category`
+/// @brief What an `err` is about.
+/// @section Variants:
+/// - Logic    : A broken program invariant.
+/// - Argument : A bad value handed to a function.
+/// - Numeric  : An arithmetic failure.
+/// - Io       : The outside world (files, operating system).
+enum class err_category: u8_t { Logic, Argument, Numeric, Io };
+
+/// @struct `err_info`
+/// @brief Compile-time metadata of one `err` variant.
+struct err_info {
+	err type;
+	const char* name;
+	u64_t name_len;
+	const char* desc;
+	err_severity severity;
+	err_category category;
+};
+
+/// @namespace `_err`
+namespace _err {
+
+/// @details Metadata of every variant in `err` order, then the entry of values outside the enumeration
+inline constexpr err_info INFO[] {
+	#define XEN_ERR_INFO(name, severity, category, desc) \
+		{err::name, #name, sizeof(#name) - 1, desc, err_severity::severity, err_category::category},
+	XEN_ERR_LIST(XEN_ERR_INFO)
+	#undef XEN_ERR_INFO
+	{static_cast<err>(0xFF), "Unknown", 7, "Not a variant of `err`.", err_severity::Fatal, err_category::Logic},
 };
 
+/// @details No.of `err` variants
+inline constexpr u64_t COUNT = sizeof(INFO) / sizeof(INFO[0]) - 1;
+static_assert(COUNT < 0xFF, "`err` must fit a `u8_t` with `0xFF` left free");
+
+/// @details Hash buckets of `from_string`, a quarter filled so a collision free seed is quickly found
+inline constexpr u64_t BUCKETS = [] {
+	u64_t buckets = 1;
+	while (buckets < COUNT * 4) buckets *= 2;
+	return buckets;
+}();
+
+/// @returns Bucket of `text` under `seed` (seeded FNV-1a)
+[[nodiscard]] constexpr u64_t hash(const char* text, u64_t len, u64_t seed) noexcept {
+	u64_t h = 0xCBF29CE484222325ull ^ (seed * 0x9E3779B97F4A7C15ull);
+	for (u64_t i = 0; i < len; ++i) h = (h ^ static_cast<u8_t>(text[i])) * 0x100000001B3ull;
+	return (h ^ (h >> 32)) & (BUCKETS - 1);
+}
+
+/// @struct `perfect_hash`
+/// @details A seed under which every variant name gets its own bucket, and the variant of each bucket
+struct perfect_hash {
+	u64_t seed {0};
+	u8_t slots[BUCKETS] {};
+};
+
+/// @returns The first collision free `perfect_hash`, searched at compile time
+[[nodiscard]] consteval perfect_hash build_hash() {
+	for (u64_t seed = 0;; ++seed) {
+		perfect_hash res {seed, {}};
+		for (u8_t& slot : res.slots) slot = 0xFF;
+
+		bool clash = false;
+		for (u64_t i = 0; i < COUNT && !clash; ++i) {
+			u8_t& slot = res.slots[hash(INFO[i].name, INFO[i].name_len, seed)];
+			clash = slot != 0xFF;
+			slot = static_cast<u8_t>(i);
+		}
+
+		if (!clash) return res;
+	}
+}
+
+inline constexpr perfect_hash PHF = build_hash();
+
+} /// namespace _err
+
+/// @returns Metadata of `type`, a single table load (values outside the enumeration get the `Unknown` entry)
+[[nodiscard]] constexpr const err_info& get_err_info(err type) noexcept {
+	const u64_t idx = static_cast<u8_t>(type);
+	return _err::INFO[idx < _err::COUNT ? idx : _err::COUNT];
+}
+
+/// @returns Name of `type` as spelled in the enumeration (static text)
+[[nodiscard]] constexpr const char* get_err_name(err type) noexcept { return get_err_info(type).name; }
+
+/// @returns Metadata of the variant named `text` (first `len` characters), `nullptr` if there is none
+/// @details One hash, one bucket load and one name compare, usable at compile time
+[[nodiscard]] constexpr const err_info* err_from_string(const char* text, u64_t len) noexcept {
+	const u8_t idx = _err::PHF.slots[_err::hash(text, len, _err::PHF.seed)];
+	if (idx == 0xFF) return nullptr;
+
+	const err_info& info = _err::INFO[idx];
+	if (info.name_len != len) return nullptr;
+	for (u64_t i = 0; i < len; ++i) if (info.name[i] != text[i]) return nullptr;
+
+	return &info;
+}
+
+/// @returns Metadata of the variant named by the `\0` terminated `text`, `nullptr` if there is none
+[[nodiscard]] constexpr const err_info* err_from_string(const char* text) noexcept {
+	u64_t len = 0;
+	while (text[len] != '\0') ++len;
+	return err_from_string(text, len);
+}
+
 } /// namespace xen
 
-#endif /// XEN_ERR
\ No newline at end of file
+#endif /// XEN_ERR
@@ -3,31 +3,414 @@
 #ifndef XEN_ERR_CTX
 #define XEN_ERR_CTX
 
+#include <charconv>
+#include <cstring>
+#include <ostream>
+#include <source_location>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "core/numdef.hpp"
+#include "core/safe_int.hpp"
 #include "err/err.hpp"
 #include "str/str.hpp"
+#include "str/str_slice.hpp"
+
+#ifdef XEN_ERR_CTX_TRACE
+#include "err/err_trace.hpp"
+#endif /// XEN_ERR_CTX_TRACE
 
 namespace xen {
 
+/// @class `err_desc`
+/// @brief The description of an `err_ctx`, which only allocates for long dynamic messages.
+/// @section Features:
+/// - String literals are stored by pointer, nothing is copied (checked at compile time through `consteval`),
+///   text in non `const` arrays is copied like any dynamic message.
+/// - Dynamic messages of up to `INLINE_CAP` characters are copied into an inline buffer.
+/// - Longer dynamic messages are copied to the heap.
+/// - Always `\0` terminated, 64 bytes in total.
+class err_desc {
+private:
+	enum class _kind : u8_t { Static, Inline, Heap };
+
+	static constexpr u64_t _INLINE_SIZE = 51;
+
+	const char* _ptr {""};
+	u32_t _len {0};
+	_kind _storage {_kind::Static};
+	char _inline[_INLINE_SIZE] {};
+
+#pragma region /// Helpers
+
+	/// @warning `_storage` must not be `Heap` before calling
+	void _copy(const char* text, u64_t len) {
+		_len = static_cast<u32_t>(len);
+
+		if (len < _INLINE_SIZE) {
+			_storage = _kind::Inline;
+			std::memcpy(_inline, text, len);
+			_inline[len] = '\0';
+			return;
+		}
+
+		char* buf = new char[len + 1];
+		std::memcpy(buf, text, len);
+		buf[len] = '\0';
+		_ptr = buf;
+		_storage = _kind::Heap;
+	}
+
+	constexpr void _free() noexcept {
+		if (_storage == _kind::Heap) delete[] _ptr;
+		_ptr = "";
+		_len = 0;
+		_storage = _kind::Static;
+	}
+
+	/// `true` for `const` character arrays, the only text `consteval` may keep by pointer
+	template <typename T_>
+	static constexpr bool _is_const_array_v = std::is_array_v<std::remove_reference_t<T_>> && std::is_const_v<std::remove_reference_t<T_>>;
+
+#pragma endregion /// Helpers
+
+public:
+	/// @details Longest dynamic message kept inline
+	static constexpr u64_t INLINE_CAP = _INLINE_SIZE - 1;
+
+#pragma region /// Constructors & Destructors
+
+	[[nodiscard]] constexpr err_desc() noexcept = default;
+
+	/// @details Stores the literal by pointer, only accepts constant text of static storage (a literal or a `static constexpr` array),
+	/// its length is up to the first `'\0'`, so a padded `char[64]` table keeps the length of its text
+	/// @note A `const` array of automatic storage, or one which isn't `constexpr`, doesn't compile here,
+	/// copy it through `err_desc(text, len)`
+	template <u64_t N_>
+	[[nodiscard]] consteval err_desc(const char (&text)[N_]) noexcept
+	: _ptr{text}, _len{static_cast<u32_t>(std::char_traits<char>::length(text))} {}
+
+	/// @details Copies a dynamic message (inline when short enough), including text in non `const` arrays
+	template <typename T_>
+		requires std::is_convertible_v<T_, const char*> && (!_is_const_array_v<T_>)
+	[[nodiscard]] err_desc(T_&& text) {
+		const char* raw = text;
+		if (raw != nullptr) _copy(raw, std::strlen(raw));
+	}
+
+	/// @details Copies `len` characters of `text` (inline when short enough)
+	[[nodiscard]] err_desc(const char* text, u64_t len) { if (len != 0) _copy(text, len); }
+
+	[[nodiscard]] err_desc(const str& text) { if (!text.is_empty()) _copy(text.c_str(), text.len()); }
+
+	/// @returns A description pointing at `text` without copying
+	/// @warning `text` must outlive every copy of the description (for text in static tables)
+	[[nodiscard]] static err_desc from_static(const char* text) noexcept {
+		err_desc desc;
+		if (text != nullptr) {
+			desc._ptr = text;
+			desc._len = static_cast<u32_t>(std::strlen(text));
+		}
+
+		return desc;
+	}
+
+	constexpr ~err_desc() noexcept { _free(); }
+
+#pragma endregion /// Constructors & Destructors
+#pragma region /// Copy semantics
+
+	[[nodiscard]] err_desc(const err_desc& other) { *this = other; }
+
+	err_desc& operator=(const err_desc& other) {
+		if (&other == this) [[unlikely]] return *this;
+
+		_free();
+		if (other._storage == _kind::Static) {
+			_ptr = other._ptr;
+			_len = other._len;
+		} else {
+			_copy(other.c_str(), other._len);
+		}
+
+		return *this;
+	}
+
+#pragma endregion /// Copy semantics
+#pragma region /// Move semantics
+
+	[[nodiscard]] err_desc(err_desc&& other) noexcept { *this = std::move(other); }
+
+	err_desc& operator=(err_desc&& other) noexcept {
+		if (&other == this) [[unlikely]] return *this;
+
+		_free();
+		_ptr = other._ptr;
+		_len = other._len;
+		_storage = other._storage;
+		if (_storage == _kind::Inline) std::memcpy(_inline, other._inline, _len + 1);
+
+		/// a moved heap buffer now belongs to `*this`
+		other._storage = _kind::Static;
+		other._free();
+		return *this;
+	}
+
+#pragma endregion /// Move semantics
+#pragma region /// Description utils
+
+	/// @returns The `\0` terminated description
+	[[nodiscard]] constexpr const char* c_str() const noexcept { return _storage == _kind::Inline ? _inline : _ptr; }
+
+	/// @returns Total no.of characters in the description
+	[[nodiscard]] constexpr u_size len() const noexcept { return _len; }
+
+	/// @returns `true` if the description is borrowed rather than copied
+	[[nodiscard]] constexpr bool is_static() const noexcept { return _storage == _kind::Static; }
+
+	/// @returns `true` if the description lives on the heap
+	[[nodiscard]] constexpr bool is_heap() const noexcept { return _storage == _kind::Heap; }
+
+#pragma endregion /// Description utils
+};
+
+/// @class `err_args`
+/// @brief Format arguments of an `err_ctx`, captured by value so the message is only rendered on demand.
+/// @section Features:
+/// - Up to `MAX_ARGS` arguments: integers, `safe_int`, `bool`, `char`, floating points, `err`,
+///   and text (`const char*`, `str`, `str_slice`).
+/// - Text is copied into a `TEXT_CAP` byte inline pool, text past its end is cut short and marked with `...`.
+/// - Trivially copyable, capturing never allocates.
+class err_args {
+private:
+	enum class _kind : u8_t { Unsigned, Signed, Float, Bool, Char, Err, Text };
+
+	struct _arg {
+		union {
+			u64_t u;
+			i64_t i;
+			double f;
+		} val {0};
+
+		_kind kind {_kind::Unsigned};
+		u8_t offset {0}; /// Text only: start in `_pool`
+		u8_t len {0};    /// Text only: no.of characters in `_pool`
+		bool cut {false}; /// Text only: `true` if the text did not fit
+	};
+
+	static constexpr u64_t _MAX_ARGS = 4;
+	static constexpr u64_t _TEXT_CAP = 32;
+
+	_arg _args[_MAX_ARGS] {};
+	char _pool[_TEXT_CAP] {};
+	u8_t _count {0};
+	u8_t _used {0};
+
+#pragma region /// Helpers
+
+	void _push_text(const char* text, u64_t len) noexcept {
+		_arg& arg = _args[_count++];
+		const u64_t room = _TEXT_CAP - _used;
+
+		arg.kind = _kind::Text;
+		arg.offset = _used;
+		arg.len = static_cast<u8_t>(len < room ? len : room);
+		arg.cut = len > room;
+
+		if (arg.len != 0) std::memcpy(_pool + _used, text, arg.len);
+		_used = static_cast<u8_t>(_used + arg.len);
+	}
+
+	template <typename A_>
+	void _push(const A_& val) noexcept {
+		if constexpr (std::is_same_v<A_, bool>) {
+			_args[_count].kind = _kind::Bool;
+			_args[_count++].val.u = val;
+		} else if constexpr (std::is_same_v<A_, char>) {
+			_args[_count].kind = _kind::Char;
+			_args[_count++].val.u = static_cast<u8_t>(val);
+		} else if constexpr (std::is_same_v<A_, err>) {
+			_args[_count].kind = _kind::Err;
+			_args[_count++].val.u = static_cast<u8_t>(val);
+		} else if constexpr (int_operand<A_>) {
+			const auto raw = raw_int(val);
+			if constexpr (std::is_signed_v<decltype(raw)>) {
+				_args[_count].kind = _kind::Signed;
+				_args[_count++].val.i = raw;
+			} else {
+				_args[_count].kind = _kind::Unsigned;
+				_args[_count++].val.u = raw;
+			}
+		} else if constexpr (std::is_floating_point_v<A_>) {
+			_args[_count].kind = _kind::Float;
+			_args[_count++].val.f = static_cast<double>(val);
+		} else if constexpr (std::is_same_v<A_, str> || std::is_same_v<A_, str_slice>) {
+			_push_text(val.begin(), val.len());
+		} else {
+			const char* text = val;
+			if (text == nullptr) _push_text("(null)", 6);
+			else _push_text(text, std::strlen(text));
+		}
+	}
+
+	/// @details Calls `put(const char*, u64_t)` with the text of argument `i`
+	template <typename F_>
+	void _emit_arg(u64_t i, F_& put) const {
+		const _arg& arg = _args[i];
+		char buf[32];
+		std::to_chars_result res {buf, std::errc{}};
+
+		switch (arg.kind) {
+			case _kind::Unsigned: res = std::to_chars(buf, buf + sizeof(buf), arg.val.u); break;
+			case _kind::Signed:   res = std::to_chars(buf, buf + sizeof(buf), arg.val.i); break;
+			case _kind::Float:    res = std::to_chars(buf, buf + sizeof(buf), arg.val.f); break;
+			case _kind::Bool:     return arg.val.u ? put("true", 4) : put("false", 5);
+			case _kind::Char:     buf[0] = static_cast<char>(arg.val.u); return put(buf, 1);
+			case _kind::Err: {
+				const err_info& info = get_err_info(static_cast<err>(arg.val.u));
+				return put(info.name, info.name_len);
+			}
+			case _kind::Text:
+				put(_pool + arg.offset, arg.len);
+				if (arg.cut) put("...", 3);
+				return;
+		}
+
+		put(buf, static_cast<u64_t>(res.ptr - buf));
+	}
+
+#pragma endregion /// Helpers
+
+public:
+	/// @details Most arguments one `err_ctx` captures
+	static constexpr u64_t MAX_ARGS = _MAX_ARGS;
+
+	/// @details Characters of text arguments kept in total
+	static constexpr u64_t TEXT_CAP = _TEXT_CAP;
+
+	/// @details `true` if `A_` can be captured
+	template <typename A_>
+	static constexpr bool is_capturable_v = std::is_arithmetic_v<A_> || is_safe_int_v<A_> || std::is_same_v<A_, err>
+		|| std::is_same_v<A_, str> || std::is_same_v<A_, str_slice> || std::is_convertible_v<A_, const char*>;
+
+	[[nodiscard]] constexpr err_args() noexcept = default;
+
+	template <typename... A_>
+		requires (sizeof...(A_) <= _MAX_ARGS && (is_capturable_v<std::decay_t<const A_>> && ...))
+	[[nodiscard]] explicit err_args(const A_&... args) noexcept {
+		(_push<std::decay_t<const A_>>(args), ...);
+	}
+
+	/// @returns No.of captured arguments
+	[[nodiscard]] constexpr u64_t get_count() const noexcept { return _count; }
+
+	/// @details Renders `fmt`, every `{}` replaced by the next argument (`{{` / `}}` escape a brace),
+	/// by calling `put(const char*, u64_t)` piece by piece
+	/// @note A `{}` past the last argument is kept as is, unused arguments are dropped
+	template <typename F_>
+	void render(const char* fmt, F_&& put) const {
+		u64_t next = 0;
+		const char* run = fmt;
+
+		for (const char* it = fmt; *it != '\0'; ++it) {
+			const bool open = it[0] == '{' && (it[1] == '}' || it[1] == '{');
+			const bool close = it[0] == '}' && it[1] == '}';
+			if (!open && !close) continue;
+			if (it[1] == '}' && it[0] == '{' && next >= _count) continue;
+
+			if (it != run) put(run, static_cast<u64_t>(it - run));
+			if (it[0] == '{' && it[1] == '}') _emit_arg(next++, put);
+			else put(it, 1);
+
+			run = ++it + 1;
+		}
+
+		if (*run != '\0') put(run, std::strlen(run));
+	}
+};
+
+/// @struct `_err_fmt`
+/// @details Description of an `err_ctx`, remembering the call site it was written at
+struct _err_fmt {
+	err_desc desc;
+	std::source_location site;
+
+	template <u64_t N_>
+	[[nodiscard]] consteval _err_fmt(const char (&text)[N_], std::source_location loc = std::source_location::current()) noexcept
+	: desc{text}, site{loc} {}
+
+	template <typename D_>
+		requires std::is_constructible_v<err_desc, D_>
+			&& (!std::is_array_v<std::remove_reference_t<D_>> || !std::is_const_v<std::remove_reference_t<D_>>)
+	[[nodiscard]] _err_fmt(D_&& text, std::source_location loc = std::source_location::current())
+	: desc{std::forward<D_>(text)}, site{loc} {}
+};
+
 /// @class `err_ctx`
 /// @brief A class that contains verbose info on the thrown err.
-/// TODO: xen::f_str support
+/// @section Features:
+/// - Constructing from a string literal never allocates, see `err_desc`.
+/// - With arguments, `DESC` is an `{}` format and the arguments are captured by value (see `err_args`),
+///   the message is only rendered by `get_msg()` or `<<`, errors which are just caught & counted never format.
+/// - `SITE` is the `std::source_location` the description was written at (a pointer to static data).
+/// - With `XEN_ERR_CTX_TRACE` defined, `TRACE` holds the raw return addresses of the constructing stack,
+///   symbolized only when printed (see `err_trace`).
 class err_ctx {
 public:
 	const err TYPE {err::Logic};
-	const str DESC;
+	const err_desc DESC;
+	const err_args ARGS;
+	const std::source_location SITE;
+
+	#ifdef XEN_ERR_CTX_TRACE
+	const err_trace TRACE;
+	#endif /// XEN_ERR_CTX_TRACE
 
 	[[nodiscard]] constexpr err_ctx() noexcept = delete;
 
-	[[nodiscard]] err_ctx(err type, const char* desc) noexcept : TYPE{type}, DESC{desc} {}
+	/// @note Always inlined, so a captured trace starts at the function constructing the error
+	template <typename... A_>
+	[[nodiscard, gnu::always_inline]] err_ctx(err type, _err_fmt fmt, const A_&... args) noexcept
+	: TYPE{type}, DESC{std::move(fmt.desc)}, ARGS{args...}, SITE{fmt.site}
+	#ifdef XEN_ERR_CTX_TRACE
+	, TRACE{err_trace::capture()}
+	#endif /// XEN_ERR_CTX_TRACE
+	{}
+
+	/// @returns The rendered message (`DESC` with `ARGS` substituted)
+	[[nodiscard]] str get_msg() const {
+		u64_t len = 0;
+		ARGS.render(DESC.c_str(), [&len](const char*, u64_t n) { len += n; });
+
+		str msg = str::with_len(len);
+		char* out = msg.begin();
+		ARGS.render(DESC.c_str(), [&out](const char* piece, u64_t n) {
+			std::memcpy(out, piece, n);
+			out += n;
+		});
 
-	#ifdef _OSTREAM_
+		return msg;
+	}
+
+	/// @details Renders straight into `os` followed by the call site (and the symbolized trace), nothing is allocated
 	friend std::ostream& operator<<(std::ostream& os, const err_ctx& err_ctx) noexcept {
-		os << "[ERR]: " << static_cast<u8_t>(err_ctx.TYPE) << ": " << err_ctx.DESC.c_str() << std::endl;
+		os << "[ERR]: " << get_err_name(err_ctx.TYPE) << ": ";
+		err_ctx.ARGS.render(err_ctx.DESC.c_str(), [&os](const char* piece, u64_t n) {
+			os.write(piece, static_cast<std::streamsize>(n));
+		});
+
+		if (err_ctx.SITE.line() != 0) os << " @ " << err_ctx.SITE.file_name() << ':' << err_ctx.SITE.line();
+		os << std::endl;
+
+		#ifdef XEN_ERR_CTX_TRACE
+		os << err_ctx.TRACE;
+		#endif /// XEN_ERR_CTX_TRACE
+
 		return os;
 	}
-	#endif /// _OSTREAM_
 };
 
 } /// namespace xen
 
-#endif /// XEN_ERR_CTX
\ No newline at end of file
+#endif /// XEN_ERR_CTX
@@ -0,0 +1,195 @@
+#pragma once
+
+#ifndef XEN_ERR_LIMITER
+#define XEN_ERR_LIMITER
+
+#include <atomic>
+#include <chrono>
+#include <source_location>
+#include <span>
+
+#include "core/numdef.hpp"
+#include "err/err.hpp"
+#include "err/err_ctx.hpp"
+
+namespace xen {
+
+/// @struct `err_site_summary`
+/// @brief What one error site did during a summary window.
+struct err_site_summary {
+	err type {err::Logic};
+	const char* fmt {nullptr};   /// Format of the site's `err_ctx`
+	const char* file {nullptr};  /// Source file of the site
+	u32_t line {0};
+	u64_t reported {0};          /// Errors let through the rate limit
+	u64_t suppressed {0};        /// Errors only counted
+	std::span<const err_args> samples {}; /// Uniform sample of the suppressed errors' arguments (render with `fmt`)
+};
+
+/// @class `err_limiter`
+/// @brief Per call site rate limit and sampling of error reports, see `XEN_ERR_REPORT`.
+/// @section Features:
+/// - Token bucket of `per_sec` tokens per second holding at most `burst`, kept as a single atomic
+///   "theoretical arrival time" (GCRA), so `admit` is one load and one CAS, no locks.
+/// - Suppressed errors are counted, never formatted: their arguments go through reservoir sampling
+///   into `SAMPLES` slots, so each window keeps a uniform sample of what was dropped.
+/// - Limiters register themselves in a global lock-free list once, `summarize` visits them all
+///   and starts a new window, `is_due` elects one caller per period to do it.
+/// @warning Limiters must have static storage duration (the list is never pruned), `XEN_ERR_REPORT` makes them so
+class err_limiter {
+private:
+	static constexpr u64_t _SAMPLES = 4;
+
+	struct _sample {
+		std::atomic<bool> busy {false};
+		err_args args {};
+	};
+
+	const err _type;
+	const char* const _fmt;
+	const std::source_location _site;
+	const u64_t _interval_ns;
+	const u64_t _tolerance_ns;
+	const bool _muted; /// `per_sec` or `burst` of 0, nothing is let through
+
+	std::atomic<u64_t> _tat {0};
+	std::atomic<u64_t> _reported {0};
+	std::atomic<u64_t> _suppressed {0};
+	_sample _samples[_SAMPLES] {};
+	err_limiter* _next {nullptr};
+
+	static inline std::atomic<err_limiter*> _head {nullptr};
+	static inline std::atomic<u64_t> _last_summary {0};
+
+#pragma region /// Helpers
+
+	[[nodiscard]] static u64_t _now_ns() noexcept {
+		return static_cast<u64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	/// @returns A per-thread xorshift random number
+	[[nodiscard]] static u64_t _rand() noexcept {
+		thread_local u64_t state = reinterpret_cast<u64_t>(&state) | 1;
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+#pragma endregion /// Helpers
+
+public:
+	/// @details Suppressed errors sampled per window
+	static constexpr u64_t SAMPLES = _SAMPLES;
+
+#pragma region /// Constructors
+
+	/// @details A limiter letting `per_sec` errors a second through, `burst` of them back to back
+	/// @note `type` and `fmt` only label the summaries of the site
+	/// @note A `per_sec` or `burst` of 0 mutes the site: `admit` always fails, every error is only counted & sampled
+	template <u64_t N_>
+	[[nodiscard]] err_limiter(u64_t per_sec, u64_t burst, err type, const char (&fmt)[N_],
+		std::source_location site = std::source_location::current()) noexcept
+	: _type{type}, _fmt{fmt}, _site{site}
+	, _interval_ns{u64_t{1'000'000'000} / (per_sec == 0 ? 1 : per_sec)}
+	, _tolerance_ns{_interval_ns * (burst == 0 ? 0 : burst - 1)}
+	, _muted{per_sec == 0 || burst == 0} {
+		_next = _head.load(std::memory_order_relaxed);
+		while (!_head.compare_exchange_weak(_next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+	}
+
+	err_limiter(const err_limiter&) = delete;
+	err_limiter& operator=(const err_limiter&) = delete;
+
+#pragma endregion /// Constructors
+#pragma region /// Reporting
+
+	/// @returns `true` (and takes a token) if an error may be reported now
+	[[nodiscard]] bool admit() noexcept {
+		if (_muted) return false;
+
+		const u64_t now = _now_ns();
+		u64_t tat = _tat.load(std::memory_order_relaxed);
+
+		for (;;) {
+			const u64_t base = tat > now ? tat : now;
+			if (base - now > _tolerance_ns) return false;
+			if (_tat.compare_exchange_weak(tat, base + _interval_ns, std::memory_order_relaxed)) break;
+		}
+
+		_reported.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/// @details Counts a suppressed error, its arguments captured only if the reservoir picks them
+	/// @note A sample slot being written by another thread is skipped rather than waited for
+	template <typename... A_>
+	void suppress(const A_&... args) noexcept {
+		const u64_t n = _suppressed.fetch_add(1, std::memory_order_relaxed) + 1;
+		const u64_t slot = n <= _SAMPLES ? n - 1 : _rand() % n;
+		if (slot >= _SAMPLES) return;
+
+		_sample& sample = _samples[slot];
+		if (sample.busy.exchange(true, std::memory_order_acquire)) return;
+		sample.args = err_args{args...};
+		sample.busy.store(false, std::memory_order_release);
+	}
+
+#pragma endregion /// Reporting
+#pragma region /// Summaries
+
+	/// @details Calls `sink(const err_site_summary&)` for every site with activity since the last call,
+	/// then starts a new window (counters are taken with an atomic exchange, no event is lost or counted twice)
+	template <typename F_>
+	static void summarize(F_&& sink) {
+		for (err_limiter* lim = _head.load(std::memory_order_acquire); lim != nullptr; lim = lim->_next) {
+			const u64_t reported = lim->_reported.exchange(0, std::memory_order_relaxed);
+			const u64_t suppressed = lim->_suppressed.exchange(0, std::memory_order_relaxed);
+			if (reported == 0 && suppressed == 0) continue;
+
+			err_args samples[_SAMPLES];
+			u64_t taken = 0;
+			for (u64_t i = 0; i < _SAMPLES && i < suppressed; ++i) {
+				_sample& sample = lim->_samples[i];
+				if (sample.busy.exchange(true, std::memory_order_acquire)) continue;
+				samples[taken++] = sample.args;
+				sample.busy.store(false, std::memory_order_release);
+			}
+
+			sink(err_site_summary{
+				lim->_type, lim->_fmt, lim->_site.file_name(), lim->_site.line(),
+				reported, suppressed, std::span<const err_args>{samples, taken},
+			});
+		}
+	}
+
+	/// @returns `true` for exactly one caller once every `period_ns`, to decide who runs `summarize`
+	[[nodiscard]] static bool is_due(u64_t period_ns) noexcept {
+		const u64_t now = _now_ns();
+		u64_t last = _last_summary.load(std::memory_order_relaxed);
+		return now - last >= period_ns && _last_summary.compare_exchange_strong(last, now, std::memory_order_relaxed);
+	}
+
+#pragma endregion /// Summaries
+};
+
+} /// namespace xen
+
+/// @details Hands `xen::err_ctx{type, fmt, args...}` to `report` at most `per_sec` times a second (`burst` back to back)
+/// from this call site, the rest are only counted & sampled into `xen::err_limiter::summarize`
+/// @note `per_sec`, `burst`, `type` and `fmt` (a string literal) must be constant expressions: the site's limiter
+/// is built once, on the first call, so they are checked at compile time rather than silently frozen.
+/// Each is evaluated once, only `report` and the arguments are evaluated per call
+#define XEN_ERR_REPORT(per_sec, burst, report, type, fmt, ...) \
+	do { \
+		static constexpr ::xen::u64_t _xen_per_sec = (per_sec); \
+		static constexpr ::xen::u64_t _xen_burst = (burst); \
+		static constexpr ::xen::err _xen_type = (type); \
+		static constexpr const auto& _xen_fmt = fmt; \
+		static ::xen::err_limiter _xen_err_limiter {_xen_per_sec, _xen_burst, _xen_type, _xen_fmt}; \
+		if (_xen_err_limiter.admit()) report(::xen::err_ctx{_xen_type, _xen_fmt __VA_OPT__(,) __VA_ARGS__}); \
+		else _xen_err_limiter.suppress(__VA_ARGS__); \
+	} while (false)
+
+#endif /// XEN_ERR_LIMITER
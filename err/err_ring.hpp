@@ -0,0 +1,226 @@
+#pragma once
+
+#ifndef XEN_ERR_RING
+#define XEN_ERR_RING
+
+#include <atomic>
+#include <chrono>
+#include <source_location>
+#include <span>
+
+#include "core/numdef.hpp"
+#include "err/err.hpp"
+#include "err/err_ctx.hpp"
+
+namespace xen {
+
+/// @struct `err_record`
+/// @brief A compact record of one error, as stored by `err_ring`.
+struct err_record {
+	err type {err::Logic};
+	u64_t thread {0};            /// Registration order of the recording thread
+	u64_t stamp_ns {0};          /// `steady_clock` time of the recording
+	const char* desc {nullptr};  /// Static description, `nullptr` if the error only had a dynamic one
+	const char* file {nullptr};  /// Source file of the error
+	u32_t line {0};
+};
+
+/// @namespace `_err_ring`
+namespace _err_ring {
+
+/// @returns A small per-thread id, threads are numbered on first use
+[[nodiscard]] inline u64_t thread_id() noexcept {
+	static std::atomic<u64_t> next {0};
+	thread_local const u64_t id = next.fetch_add(1, std::memory_order_relaxed);
+	return id;
+}
+
+} /// namespace _err_ring
+
+/// @class `err_ring`
+/// @brief A bounded lock-free ring of `err_record`s, many threads record and one thread drains.
+/// @section Features:
+/// - `push` never locks or allocates: a ticket `fetch_add`, a few relaxed stores, a release store.
+/// - Overwrites the oldest records once full, the consumer counts what it missed in `get_lost()`.
+/// - Every slot is a seqlock (`2 * ticket + 1` while written, `2 * ticket + 2` once done),
+///   so the consumer never reads a torn record.
+/// - `drain` hands records to a sink in batches of up to `BATCH` (`std::span<const err_record>`).
+/// - Messages are kept by handle only: the static description pointer and the call site.
+/// @warning `drain` must only ever be called from one thread at a time
+/// @note A producer which laps onto a slot still being written drops its own record (counted in `get_lost()`)
+/// instead of waiting, so a producer preempted mid-write never blocks another one
+template <u64_t CAP_ = 1024>
+	requires (CAP_ > 0 && (CAP_ & (CAP_ - 1)) == 0)
+class err_ring {
+private:
+	static constexpr u64_t _MASK = CAP_ - 1;
+
+	struct alignas(64) _slot {
+		std::atomic<u64_t> seq {0};
+		std::atomic<u64_t> meta {0}; /// type in the top byte, thread id below
+		std::atomic<u64_t> stamp {0};
+		std::atomic<const char*> desc {nullptr};
+		std::atomic<const char*> file {nullptr};
+		std::atomic<u64_t> line {0};
+		std::atomic<u64_t> skipped {0}; /// newest ticket + 1 given up on this slot while it was busy
+	};
+
+	alignas(64) std::atomic<u64_t> _head {0};
+	alignas(64) u64_t _tail {0};
+	u64_t _lost {0};
+	_slot _slots[CAP_] {};
+
+#pragma region /// Helpers
+
+	void _write(const err_record& rec) noexcept {
+		const u64_t ticket = _head.fetch_add(1, std::memory_order_relaxed);
+		_slot& slot = _slots[ticket & _MASK];
+		const u64_t writing = 2 * ticket + 1;
+
+		u64_t seq = slot.seq.load(std::memory_order_relaxed);
+		for (;;) {
+			/// a newer ticket already took the slot, this record counts as overwritten
+			if (seq > writing) return;
+
+			/// an older ticket is still writing the slot, drop this record rather than wait for it
+			if (seq % 2 == 1) {
+				u64_t skipped = slot.skipped.load(std::memory_order_relaxed);
+				while (skipped < ticket + 1
+					&& !slot.skipped.compare_exchange_weak(skipped, ticket + 1, std::memory_order_release, std::memory_order_relaxed)) {}
+				return;
+			}
+
+			if (slot.seq.compare_exchange_weak(seq, writing, std::memory_order_acquire, std::memory_order_relaxed)) break;
+		}
+
+		/// orders the odd sequence before the fields, so a reader seeing a new field also sees the slot is busy
+		std::atomic_thread_fence(std::memory_order_release);
+
+		slot.meta.store((u64_t{static_cast<u8_t>(rec.type)} << 56) | (rec.thread & 0x00FF'FFFF'FFFF'FFFFull), std::memory_order_relaxed);
+		slot.stamp.store(rec.stamp_ns, std::memory_order_relaxed);
+		slot.desc.store(rec.desc, std::memory_order_relaxed);
+		slot.file.store(rec.file, std::memory_order_relaxed);
+		slot.line.store(rec.line, std::memory_order_relaxed);
+		slot.seq.store(writing + 1, std::memory_order_release);
+	}
+
+	/// @returns `true` if the record of `ticket` was read into `rec`, `stop` set if it isn't written yet
+	[[nodiscard]] bool _read(u64_t ticket, err_record& rec, bool& stop) const noexcept {
+		const _slot& slot = _slots[ticket & _MASK];
+		const u64_t done = 2 * ticket + 2;
+
+		const u64_t before = slot.seq.load(std::memory_order_acquire);
+		if (before < done) {
+			/// the producer of `ticket` gave up on a busy slot, the record is lost rather than late
+			stop = slot.skipped.load(std::memory_order_acquire) <= ticket;
+			return false;
+		}
+
+		if (before > done) return false;
+
+		const u64_t meta = slot.meta.load(std::memory_order_relaxed);
+		rec.type = static_cast<err>(meta >> 56);
+		rec.thread = meta & 0x00FF'FFFF'FFFF'FFFFull;
+		rec.stamp_ns = slot.stamp.load(std::memory_order_relaxed);
+		rec.desc = slot.desc.load(std::memory_order_relaxed);
+		rec.file = slot.file.load(std::memory_order_relaxed);
+		rec.line = static_cast<u32_t>(slot.line.load(std::memory_order_relaxed));
+
+		/// unchanged sequence after the reads means no producer lapped onto the slot meanwhile
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return slot.seq.load(std::memory_order_relaxed) == done;
+	}
+
+#pragma endregion /// Helpers
+
+public:
+	/// @details Most records handed to the sink per call
+	static constexpr u64_t BATCH = 64;
+
+#pragma region /// Constructors
+
+	[[nodiscard]] err_ring() noexcept = default;
+
+	err_ring(const err_ring&) = delete;
+	err_ring& operator=(const err_ring&) = delete;
+
+#pragma endregion /// Constructors
+#pragma region /// Producers
+
+	/// @details Records `ctx`, keeping its description only if it is static
+	void push(const err_ctx& ctx) noexcept {
+		_write(err_record{
+			ctx.TYPE, _err_ring::thread_id(), now_ns(),
+			ctx.DESC.is_static() ? ctx.DESC.c_str() : nullptr,
+			ctx.SITE.file_name(), ctx.SITE.line(),
+		});
+	}
+
+	/// @details Records an error of `type` at the calling site
+	/// @warning `desc` is kept by pointer, it must be static text (a literal or a static table)
+	void push(err type, const char* desc = nullptr, std::source_location site = std::source_location::current()) noexcept {
+		_write(err_record{type, _err_ring::thread_id(), now_ns(), desc, site.file_name(), site.line()});
+	}
+
+#pragma endregion /// Producers
+#pragma region /// Consumer
+
+	/// @details Hands every record written so far (up to `max`) to `sink(std::span<const err_record>)`, oldest first
+	/// @returns No.of records drained
+	/// @note Stops early at a record still being written, the next `drain` resumes from it
+	template <typename F_>
+	u64_t drain(F_&& sink, u64_t max = U64_MAX) {
+		err_record batch[BATCH];
+		u64_t filled = 0;
+		u64_t total = 0;
+
+		const u64_t head = _head.load(std::memory_order_acquire);
+		if (head - _tail > CAP_) {
+			/// everything older than the last `CAP_` tickets has been overwritten
+			_lost += head - CAP_ - _tail;
+			_tail = head - CAP_;
+		}
+
+		while (_tail < head && total < max) {
+			bool stop = false;
+			if (_read(_tail, batch[filled], stop)) {
+				++filled;
+				++total;
+			} else if (stop) {
+				break;
+			} else {
+				++_lost;
+			}
+
+			++_tail;
+			if (filled == BATCH) {
+				sink(std::span<const err_record>{batch, filled});
+				filled = 0;
+			}
+		}
+
+		if (filled != 0) sink(std::span<const err_record>{batch, filled});
+		return total;
+	}
+
+	/// @returns No.of records overwritten before they could be drained
+	/// @warning Consumer side, read it from the draining thread
+	[[nodiscard]] u64_t get_lost() const noexcept { return _lost; }
+
+	/// @returns No.of records pushed since construction
+	[[nodiscard]] u64_t get_pushed() const noexcept { return _head.load(std::memory_order_relaxed); }
+
+	[[nodiscard]] static constexpr u64_t get_capacity() noexcept { return CAP_; }
+
+#pragma endregion /// Consumer
+
+	/// @returns The `steady_clock` time stamped on records, in nanoseconds
+	[[nodiscard]] static u64_t now_ns() noexcept {
+		return static_cast<u64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+};
+
+} /// namespace xen
+
+#endif /// XEN_ERR_RING
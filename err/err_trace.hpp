@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef XEN_ERR_TRACE
+#define XEN_ERR_TRACE
+
+#include <ostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dlfcn.h>
+#define XEN_ERR_TRACE_DLADDR
+#endif /// __unix__ || __APPLE__
+
+#include "core/numdef.hpp"
+
+namespace xen {
+
+/// @class `err_trace`
+/// @brief Raw return addresses of the calling stack, symbolized only when read.
+/// @warning Relies on frame pointers: build with `-fno-omit-frame-pointer` (GCC / Clang),
+/// frames compiled without them end the walk early. Symbolization needs `-ldl` on glibc older than 2.34
+/// @section Features:
+/// - `capture()` walks the frame pointer chain into a fixed array, no allocation, no locks, no syscalls.
+/// - Walk stops at `MAX_DEPTH` frames, a null frame, or a frame pointer which doesn't move up the stack.
+/// - `symbolize` resolves addresses through `dladdr` only when asked (symbols need `-rdynamic`),
+///   on systems without `dladdr` every frame is reported unresolved.
+class err_trace {
+private:
+	static constexpr u64_t _MAX_DEPTH = 16;
+
+	/// largest step between two frames still taken as a real caller (guards against garbage frame pointers)
+	static constexpr u64_t _MAX_FRAME_SIZE = u64_t{1} << 20;
+
+	const void* _frames[_MAX_DEPTH] {};
+	u8_t _depth {0};
+
+public:
+	/// @details Most frames one trace keeps
+	static constexpr u64_t MAX_DEPTH = _MAX_DEPTH;
+
+	[[nodiscard]] constexpr err_trace() noexcept = default;
+
+	/// @returns A trace of the caller's stack, leaving out the innermost `skip` frames
+	[[nodiscard, gnu::noinline]] static err_trace capture(u64_t skip = 0) noexcept {
+		err_trace trace;
+
+		#if defined(__GNUC__) || defined(__clang__)
+		const void* const* frame = static_cast<const void* const*>(__builtin_frame_address(0));
+
+		/// every frame holds the caller's frame pointer, then the return address into the caller
+		while (frame != nullptr && trace._depth < _MAX_DEPTH) {
+			const void* ret = frame[1];
+			if (ret == nullptr) break;
+
+			if (skip > 0) --skip;
+			else trace._frames[trace._depth++] = ret;
+
+			const void* const* next = static_cast<const void* const*>(frame[0]);
+			const u64_t at = reinterpret_cast<u64_t>(frame);
+			const u64_t up = reinterpret_cast<u64_t>(next);
+			if (up <= at || up - at > _MAX_FRAME_SIZE || up % alignof(void*) != 0) break;
+			frame = next;
+		}
+		#else
+		(void)skip;
+		#endif /// __GNUC__ || __clang__
+
+		return trace;
+	}
+
+	/// @returns No.of captured frames
+	[[nodiscard]] constexpr u64_t get_depth() const noexcept { return _depth; }
+
+	/// @returns Return address of frame `i` (innermost first), `nullptr` past the depth
+	[[nodiscard]] constexpr const void* get_frame(u64_t i) const noexcept { return i < _depth ? _frames[i] : nullptr; }
+
+	/// @details Calls `fn(u64_t i, const void* addr, const char* symbol, u64_t offset, const char* module)`
+	/// for every frame, `symbol` / `module` are `nullptr` when `dladdr` can't resolve them
+	template <typename F_>
+	void symbolize(F_&& fn) const {
+		for (u64_t i = 0; i < _depth; ++i) {
+			#ifdef XEN_ERR_TRACE_DLADDR
+			Dl_info info {};
+
+			/// a return address points past its call, step back into it to resolve the calling function
+			const void* lookup = static_cast<const char*>(_frames[i]) - 1;
+			if (::dladdr(lookup, &info) == 0) {
+				fn(i, _frames[i], static_cast<const char*>(nullptr), u64_t{0}, static_cast<const char*>(nullptr));
+				continue;
+			}
+
+			const u64_t offset = info.dli_saddr == nullptr ? u64_t{0}
+				: reinterpret_cast<u64_t>(_frames[i]) - reinterpret_cast<u64_t>(info.dli_saddr);
+			fn(i, _frames[i], info.dli_sname, offset, info.dli_fname);
+			#else
+			fn(i, _frames[i], static_cast<const char*>(nullptr), u64_t{0}, static_cast<const char*>(nullptr));
+			#endif /// XEN_ERR_TRACE_DLADDR
+		}
+	}
+
+	/// @details Writes one symbolized line per frame: `#i addr symbol+0xoffset (module)`
+	friend std::ostream& operator<<(std::ostream& os, const err_trace& trace) {
+		trace.symbolize([&os](u64_t i, const void* addr, const char* symbol, u64_t offset, const char* module) {
+			os << "  #" << i << ' ' << addr << ' ' << (symbol != nullptr ? symbol : "??");
+			if (symbol != nullptr) os << "+0x" << std::hex << offset << std::dec;
+			os << " (" << (module != nullptr ? module : "??") << ")\n";
+		});
+
+		return os;
+	}
+};
+
+} /// namespace xen
+
+#endif /// XEN_ERR_TRACE
@@ -0,0 +1,181 @@
+#pragma once
+
+#ifndef XEN_RESULT
+#define XEN_RESULT
+
+#include <type_traits>
+#include <utility>
+
+#include "core/numdef.hpp"
+#include "err/err.hpp"
+
+namespace xen {
+
+template <typename T_, typename E_>
+class result;
+
+/// @returns `true` if `T_` is a `result`
+template <typename T_> inline constexpr bool is_result_v = false;
+template <typename T_, typename E_> inline constexpr bool is_result_v<result<T_, E_>> = true;
+
+/// @details `true` if the `u8_t` sized enum `E_` never uses the value `0xFF`, so `result` can store it in its tag byte
+/// @note Opt-in (specialize it for such an enum), `err` guarantees it by static_assert (see err/err.hpp)
+template <typename E_> inline constexpr bool is_result_niche_v = false;
+template <> inline constexpr bool is_result_niche_v<err> = true;
+
+namespace _result {
+
+/// @details Tag selecting the failure constructor
+struct fail_t {};
+
+/// @details Error storage of a `result`, a single tag byte for enums leaving `0xFF` free (see `is_result_niche_v`)
+template <typename E_, bool NICHE_ = is_result_niche_v<E_>>
+struct state {
+	static_assert(std::is_enum_v<E_> && sizeof(E_) == 1, "`is_result_niche_v` is only for `u8_t` sized enums");
+
+	static constexpr u8_t OK = 0xFF;
+
+	u8_t tag {OK};
+
+	[[nodiscard]] constexpr state() noexcept = default;
+	[[nodiscard]] constexpr state(E_ type) noexcept : tag{static_cast<u8_t>(type)} {}
+
+	[[nodiscard]] constexpr bool is_ok() const noexcept { return tag == OK; }
+	[[nodiscard]] constexpr E_ get() const noexcept { return static_cast<E_>(tag); }
+};
+
+template <typename E_>
+struct state<E_, false> {
+	E_ fail {};
+	bool ok {true};
+
+	[[nodiscard]] constexpr state() noexcept(std::is_nothrow_default_constructible_v<E_>) = default;
+	[[nodiscard]] constexpr state(E_ type) noexcept(std::is_nothrow_move_constructible_v<E_>)
+	: fail{std::move(type)}, ok{false} {}
+
+	[[nodiscard]] constexpr bool is_ok() const noexcept { return ok; }
+	[[nodiscard]] constexpr const E_& get() const noexcept { return fail; }
+};
+
+} /// namespace _result
+
+/// @class `result`
+/// @brief Either a value of `T_` or the error (`err` by default) that prevented producing it.
+/// @warning `T_` and `E_` must be default constructible
+/// @section Features:
+/// - Compact: for `err` (and any `u8_t` sized enum opted in through `is_result_niche_v`) the tag byte doubles
+///   as the stored error, so the size is `T_` + 1 byte (+ padding). Other error types are stored next to a `bool`.
+/// - Never throws on construction or inspection, only `unwrap()` rethrows the stored error.
+/// - Implicitly constructs from `T_` (success) and from `E_` (failure).
+/// - Can be checked like a `bool` (`true` on success).
+/// - Chains without branching at every step (`map`, `and_then`, `or_else`), or propagates through `XEN_TRY`.
+template <typename T_, typename E_ = err>
+class result {
+private:
+	T_ _val {};
+	_result::state<E_> _state {};
+
+	[[nodiscard]] constexpr result(_result::fail_t, E_ type) noexcept(noexcept(_result::state<E_>{std::move(type)}))
+	: _state{std::move(type)} {}
+
+public:
+	typedef T_ value_type;
+	typedef E_ error_type;
+
+#pragma region /// Constructors
+
+	[[nodiscard]] constexpr result() noexcept(std::is_nothrow_default_constructible_v<T_>) = default;
+
+	[[nodiscard]] constexpr result(T_ val) noexcept(std::is_nothrow_move_constructible_v<T_>) : _val{std::move(val)} {}
+
+	[[nodiscard]] constexpr result(E_ type) noexcept(noexcept(_result::state<E_>{std::move(type)}))
+		requires (!std::is_same_v<T_, E_>)
+	: _state{std::move(type)} {}
+
+	/// @returns A successful `result` holding `val`
+	[[nodiscard]] static constexpr result ok(T_ val) noexcept(std::is_nothrow_move_constructible_v<T_>) {
+		return result{std::move(val)};
+	}
+
+	/// @returns A failed `result` holding `type`
+	[[nodiscard]] static constexpr result fail(E_ type) noexcept(noexcept(_result::state<E_>{std::move(type)})) {
+		return result{_result::fail_t{}, std::move(type)};
+	}
+
+#pragma endregion /// Constructors
+#pragma region /// Getters
+
+	/// @returns `true` if a value is held
+	[[nodiscard]] constexpr bool is_ok() const noexcept { return _state.is_ok(); }
+
+	/// @returns `true` if an error is held
+	[[nodiscard]] constexpr bool is_err() const noexcept { return !_state.is_ok(); }
+
+	[[nodiscard]] constexpr explicit operator bool() const noexcept { return is_ok(); }
+
+	/// @warning Unchecked, only meaningful if `is_ok()`
+	/// @returns The held value
+	[[nodiscard]] constexpr const T_& get_val() const& noexcept { return _val; }
+
+	/// @warning Unchecked, only meaningful if `is_ok()`
+	/// @returns The held value, moved out
+	[[nodiscard]] constexpr T_ get_val() && noexcept(std::is_nothrow_move_constructible_v<T_>) { return std::move(_val); }
+
+	/// @warning Unchecked, only meaningful if `is_err()`
+	/// @returns The held error
+	[[nodiscard]] constexpr E_ get_err() const noexcept(std::is_nothrow_copy_constructible_v<E_>) { return _state.get(); }
+
+	/// @returns The held value, or `fallback` if an error is held
+	[[nodiscard]] constexpr T_ get_or(T_ fallback) const noexcept(std::is_nothrow_copy_constructible_v<T_>) {
+		return is_ok() ? _val : fallback;
+	}
+
+	/// @returns The held value, throws the held error otherwise
+	[[nodiscard]] constexpr const T_& unwrap() const {
+		if (is_err()) [[unlikely]] throw get_err();
+		return _val;
+	}
+
+#pragma endregion /// Getters
+#pragma region /// Chaining
+
+	/// @returns `fn(value)` as a `result`, or the held error
+	template <typename F_>
+	[[nodiscard]] constexpr auto map(F_&& fn) const {
+		typedef std::remove_cvref_t<std::invoke_result_t<F_, const T_&>> U_;
+		if (is_err()) [[unlikely]] return result<U_, E_>::fail(get_err());
+		return result<U_, E_>{std::forward<F_>(fn)(_val)};
+	}
+
+	/// @returns `fn(value)` (itself a `result` with the same error type), or the held error
+	template <typename F_>
+	[[nodiscard]] constexpr auto and_then(F_&& fn) const {
+		typedef std::remove_cvref_t<std::invoke_result_t<F_, const T_&>> R_;
+		static_assert(is_result_v<R_> && std::is_same_v<typename R_::error_type, E_>, "`fn` must return a `result<U_, E_>`");
+
+		if (is_err()) [[unlikely]] return R_::fail(get_err());
+		return std::forward<F_>(fn)(_val);
+	}
+
+	/// @returns `*this` if a value is held, `fn(error)` (a `result<T_, E_>`) otherwise
+	template <typename F_>
+	[[nodiscard]] constexpr result or_else(F_&& fn) const {
+		static_assert(std::is_same_v<std::remove_cvref_t<std::invoke_result_t<F_, E_>>, result>, "`fn` must return a `result<T_, E_>`");
+
+		if (is_ok()) [[likely]] return *this;
+		return std::forward<F_>(fn)(get_err());
+	}
+
+#pragma endregion /// Chaining
+};
+
+} /// namespace xen
+
+/// @details Declares `name` as the value of the `result` `expr`, or returns its error from the enclosing function
+/// @note The enclosing function must return a `result` (or anything constructible from the error)
+#define XEN_TRY(name, expr) \
+	auto _xen_try_##name = (expr); \
+	if (_xen_try_##name.is_err()) [[unlikely]] return _xen_try_##name.get_err(); \
+	auto name = std::move(_xen_try_##name).get_val()
+
+#endif /// XEN_RESULT
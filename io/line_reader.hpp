@@ -0,0 +1,223 @@
+#pragma once
+
+#ifndef XEN_LINE_READER
+#define XEN_LINE_READER
+
+#ifdef __linux__
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif /// __AVX2__ || __SSE2__
+
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+#include "io/mapped_file.hpp"
+#include "str/str_slice.hpp"
+
+namespace xen {
+
+/// @class `line_reader`
+/// @brief Splits a file descriptor, `mapped_file` or `str_slice` into `\n` separated lines.
+/// @section Features:
+/// - Lines are yielded as `str_slice` (without the `\n`), valid until the next call to `next`.
+/// - Splits on `\n` only, the `\r` of CRLF input stays at the end of its line.
+/// - Newlines are searched 64 bytes per step (AVX2 / SSE2), `memchr` elsewhere.
+/// - Reading a descriptor reuses a single buffer, only the partial line at its end is moved.
+/// - Buffer grows when a single line is longer than it.
+/// - Mapped input is scanned in place, nothing is copied.
+/// - Reader cannot be copied, but can be moved.
+/// - Reports errors via the `err` enumeration:
+/// --> `err::IoFailure` : Reading the file descriptor failed.
+/// @warning The file descriptor is borrowed, it is not closed by the reader
+class line_reader {
+private:
+	static constexpr u64_t _DEFAULT_BUF_SIZE = u64_t{1} << 20;
+
+	int _fd {-1};
+	char* _buf {nullptr};
+	u64_t _cap {0};
+
+	const char* _data {nullptr}; /// Either `_buf` or the mapped input
+	u64_t _begin {0};            /// Start of the next line
+	u64_t _scan {0};             /// Bytes before this are known to hold no `\n`
+	u64_t _end {0};              /// End of the valid data
+	bool _eof {true};
+
+#pragma region /// Helpers
+
+	/// @returns pointer to the first `\n` in `[it, end)`, or `end` if there is none
+	[[nodiscard]] static const char* _find_newline(const char* it, const char* end) noexcept {
+		#if defined(__AVX2__)
+		const __m256i nl = _mm256_set1_epi8('\n');
+		for (; end - it >= 64; it += 64) {
+			const u32_t lo = static_cast<u32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(it)), nl)));
+			const u32_t hi = static_cast<u32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+				_mm256_loadu_si256(reinterpret_cast<const __m256i*>(it + 32)), nl)));
+
+			const u64_t mask = (u64_t{hi} << 32) | lo;
+			if (mask != 0) return it + __builtin_ctzll(mask);
+		}
+		#elif defined(__SSE2__)
+		const __m128i nl = _mm_set1_epi8('\n');
+		for (; end - it >= 64; it += 64) {
+			u64_t mask = 0;
+			for (u64_t i = 0; i < 4; ++i) {
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + i * 16));
+				mask |= u64_t{static_cast<u32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, nl)))} << (i * 16);
+			}
+
+			if (mask != 0) return it + __builtin_ctzll(mask);
+		}
+		#endif /// __AVX2__ / __SSE2__
+
+		if (it == end) return end;
+
+		const void* found = std::memchr(it, '\n', static_cast<u64_t>(end - it));
+		return found == nullptr ? end : static_cast<const char*>(found);
+	}
+
+	/// @details Moves the partial line to the front (growing if needed) and reads more data
+	void _refill() {
+		const u64_t pending = _end - _begin;
+
+		if (pending == _cap) {
+			char* grown = new char[_cap * 2];
+			std::memcpy(grown, _buf + _begin, pending);
+			delete[] _buf;
+			_buf = grown;
+			_cap *= 2;
+		} else if (_begin != 0) {
+			std::memmove(_buf, _buf + _begin, pending);
+		}
+
+		_scan -= _begin;
+		_begin = 0;
+		_end = pending;
+		_data = _buf;
+
+		while (true) {
+			const ::ssize_t got = ::read(_fd, _buf + _end, _cap - _end);
+			if (got > 0) {
+				_end += static_cast<u64_t>(got);
+				return;
+			}
+
+			if (got == 0) {
+				_eof = true;
+				return;
+			}
+
+			if (errno != EINTR) throw err::IoFailure;
+		}
+	}
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Constructors & Destructors
+
+	[[nodiscard]] constexpr explicit line_reader() noexcept = default;
+
+	/// @details Reads lines from `fd` through a `buf_size` byte buffer
+	[[nodiscard]] explicit line_reader(int fd, u_size buf_size = _DEFAULT_BUF_SIZE)
+	: _fd{fd}
+	, _buf{new char[buf_size == 0 ? 1 : static_cast<u64_t>(buf_size)]}
+	, _cap{buf_size == 0 ? 1 : static_cast<u64_t>(buf_size)}
+	, _data{_buf}
+	, _eof{false}
+	{}
+
+	/// @details Reads lines of `text` in place
+	[[nodiscard]] explicit line_reader(str_slice text) noexcept
+	: _data{text.data()}, _end{text.len()} {}
+
+	/// @details Reads lines of `file` in place
+	/// @warning `file` must outlive the reader
+	[[nodiscard]] explicit line_reader(const mapped_file& file) noexcept : line_reader{file.as_slice()} {}
+
+	~line_reader() noexcept { delete[] _buf; }
+
+#pragma endregion /// Constructors & Destructors
+#pragma region /// Copy semantics
+
+	[[nodiscard]] line_reader(const line_reader&) noexcept = delete;
+	line_reader& operator=(const line_reader&) noexcept = delete;
+
+#pragma endregion /// Copy semantics
+#pragma region /// Move semantics
+
+	[[nodiscard]] line_reader(line_reader&& other) noexcept
+	: _fd{other._fd}, _buf{other._buf}, _cap{other._cap}, _data{other._data}
+	, _begin{other._begin}, _scan{other._scan}, _end{other._end}, _eof{other._eof} {
+		other._buf = nullptr;
+		other._data = nullptr;
+		other._cap = other._begin = other._scan = other._end = 0;
+		other._eof = true;
+	}
+
+	line_reader& operator=(line_reader&& other) noexcept {
+		if (&other != this) [[likely]] {
+			delete[] _buf;
+			_fd = other._fd;
+			_buf = other._buf;
+			_cap = other._cap;
+			_data = other._data;
+			_begin = other._begin;
+			_scan = other._scan;
+			_end = other._end;
+			_eof = other._eof;
+
+			other._buf = nullptr;
+			other._data = nullptr;
+			other._cap = other._begin = other._scan = other._end = 0;
+			other._eof = true;
+		}
+
+		return *this;
+	}
+
+#pragma endregion /// Move semantics
+#pragma region /// Reading
+
+	/// @details Advances to the next line and stores it in `line`
+	/// @returns `false` once the input is exhausted
+	[[nodiscard]] bool next(str_slice& line) {
+		while (true) {
+			const char* nl = _find_newline(_data + _scan, _data + _end);
+
+			if (nl != _data + _end) {
+				const u64_t at = static_cast<u64_t>(nl - _data);
+				line = str_slice{_data + _begin, at - _begin};
+				_begin = _scan = at + 1;
+				return true;
+			}
+
+			_scan = _end;
+
+			if (_eof) {
+				if (_begin == _end) return false;
+
+				/// last line without a trailing `\n`
+				line = str_slice{_data + _begin, _end - _begin};
+				_begin = _end;
+				return true;
+			}
+
+			_refill();
+		}
+	}
+
+#pragma endregion /// Reading
+};
+
+} /// namespace xen
+
+#endif /// __linux__
+
+#endif /// XEN_LINE_READER
@@ -0,0 +1,170 @@
+#pragma once
+
+#ifndef XEN_MAPPED_FILE
+#define XEN_MAPPED_FILE
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+#include "str/str_slice.hpp"
+
+namespace xen {
+
+/// @enum `map_access`
+/// @brief Expected access pattern of a `mapped_file`, forwarded to `madvise`.
+/// @section Variants:
+/// - Normal    : No special treatment.
+/// - Sequential: Read front to back, aggressive read-ahead and early page reclaim.
+/// - Random    : Scattered reads, read-ahead disabled.
+/// - WillNeed  : Whole file is about to be read, start paging it in now.
+enum class map_access: u8_t {
+	Normal,
+	Sequential,
+	Random,
+	WillNeed,
+};
+
+/// @class `mapped_file`
+/// @brief A read-only memory mapping of a whole file (Linux only).
+/// @section Features:
+/// - Contents are exposed as a `str_slice` without reading or copying the file.
+/// - Pages are loaded lazily by the kernel, on first touch.
+/// - Access pattern hints through `madvise` (`map_access`).
+/// - Unmaps automatically when it goes out of scope (RAII, like `unique_ref`).
+/// - Mapping cannot be copied, but can be moved.
+/// - Reports errors via the `err` enumeration:
+/// --> `err::IoFailure` : The file could not be opened, inspected or mapped.
+class mapped_file {
+private:
+	char* _data {nullptr};
+	u_size _len {0};
+
+#pragma region /// Helpers
+
+	[[nodiscard]] static constexpr int _to_advice(map_access access) noexcept {
+		switch (access) {
+			case map_access::Sequential: return MADV_SEQUENTIAL;
+			case map_access::Random:     return MADV_RANDOM;
+			case map_access::WillNeed:   return MADV_WILLNEED;
+			default:                     return MADV_NORMAL;
+		}
+	}
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Constructors & Destructors
+
+	[[nodiscard]] constexpr explicit mapped_file() noexcept = default;
+
+	/// @details Maps the file at `path` read-only
+	[[nodiscard]] explicit mapped_file(const char* path, map_access access = map_access::Sequential) {
+		const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+		if (fd < 0) throw err::IoFailure;
+
+		struct stat info {};
+		if (::fstat(fd, &info) != 0) {
+			::close(fd);
+			throw err::IoFailure;
+		}
+
+		/// an empty file has nothing to map, it stays an empty slice
+		if (info.st_size > 0) {
+			void* addr = ::mmap(nullptr, static_cast<u64_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr == MAP_FAILED) {
+				::close(fd);
+				throw err::IoFailure;
+			}
+
+			_data = static_cast<char*>(addr);
+			_len = info.st_size;
+		}
+
+		/// the mapping keeps its own reference to the file
+		::close(fd);
+		advise(access);
+	}
+
+	~mapped_file() noexcept { reset(); }
+
+#pragma endregion /// Constructors & Destructors
+#pragma region /// Copy semantics
+
+	[[nodiscard]] mapped_file(const mapped_file&) noexcept = delete;
+	mapped_file& operator=(const mapped_file&) noexcept = delete;
+
+#pragma endregion /// Copy semantics
+#pragma region /// Move semantics
+
+	[[nodiscard]] mapped_file(mapped_file&& other) noexcept : _data{other._data}, _len{other._len} {
+		other._data = nullptr;
+		other._len = 0;
+	}
+
+	mapped_file& operator=(mapped_file&& other) noexcept {
+		if (&other != this) [[likely]] {
+			reset();
+			_data = other._data;
+			_len = other._len;
+			other._data = nullptr;
+			other._len = 0;
+		}
+
+		return *this;
+	}
+
+#pragma endregion /// Move semantics
+#pragma region /// Mapping utils
+
+	/// @details Unmaps the file
+	void reset() noexcept {
+		if (_data != nullptr) ::munmap(_data, _len);
+
+		_data = nullptr;
+		_len = 0;
+	}
+
+	/// @details Hints the kernel on how the mapping is about to be read
+	/// @note Hints are advisory, a rejected hint is silently ignored
+	void advise(map_access access) const noexcept {
+		if (_data != nullptr) ::madvise(_data, _len, _to_advice(access));
+	}
+
+	/// @details Hints the kernel on how `[offset, offset + count)` is about to be read
+	void advise(map_access access, u_size offset, u_size count) const {
+		if (offset > _len || count > _len - offset) throw err::IndexOutOfRange;
+		if (count == 0) return;
+
+		/// `madvise` wants a page aligned start
+		const u64_t page = static_cast<u64_t>(::sysconf(_SC_PAGESIZE));
+		const u64_t start = static_cast<u64_t>(offset) / page * page;
+		::madvise(_data + start, static_cast<u64_t>(offset + count) - start, _to_advice(access));
+	}
+
+	/// @returns The mapped contents
+	[[nodiscard]] str_slice as_slice() const noexcept { return str_slice{_data, _len}; }
+
+	/// @returns Pointer to the first mapped character
+	[[nodiscard]] const char* data() const noexcept { return _data; }
+
+	/// @returns Size of the mapped file in bytes
+	[[nodiscard]] u_size len() const noexcept { return _len; }
+
+	/// @returns `true` if the mapped file is empty or nothing is mapped
+	[[nodiscard]] bool is_empty() const noexcept { return _len == 0; }
+
+#pragma endregion /// Mapping utils
+};
+
+} /// namespace xen
+
+#endif /// __linux__
+
+#endif /// XEN_MAPPED_FILE
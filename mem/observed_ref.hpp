@@ -5,7 +5,9 @@
 
 #include <utility>
 
+#include "core/config.hpp"
 #include "core/safe_u64.hpp"
+#include "err/err.hpp"
 
 namespace xen {
 
@@ -187,8 +189,16 @@ public:
 #pragma endregion /// Ownership utils
 #pragma region /// Operator overload
 
-	constexpr T_& operator*() const noexcept { return *_ptr; }
-	constexpr T_* operator->() const noexcept { return _ptr; }
+	/// @note Checked against null per `XEN_CHECK_LEVEL` (`err::Logic`)
+	constexpr T_& operator*() const noexcept(CHECK_NOTHROW) {
+		XEN_CHECK(_ptr != nullptr, err::Logic);
+		return *_ptr;
+	}
+
+	constexpr T_* operator->() const noexcept(CHECK_NOTHROW) {
+		XEN_CHECK(_ptr != nullptr, err::Logic);
+		return _ptr;
+	}
 
 	constexpr operator bool() const noexcept { return _ptr != nullptr; }
 
@@ -3,7 +3,9 @@
 #ifndef XEN_SHARED_REF
 #define XEN_SHARED_REF
 
+#include "core/config.hpp"
 #include "core/safe_u64.hpp"
+#include "err/err.hpp"
 
 #include <utility>
 
@@ -124,8 +126,16 @@ public:
 #pragma endregion /// Ownership utils
 #pragma region /// Operator overload
 
-	constexpr T_& operator*() const noexcept { return *_ptr; }
-	constexpr T_* operator->() const noexcept { return _ptr; }
+	/// @note Checked against null per `XEN_CHECK_LEVEL` (`err::Logic`)
+	constexpr T_& operator*() const noexcept(CHECK_NOTHROW) {
+		XEN_CHECK(_ptr != nullptr, err::Logic);
+		return *_ptr;
+	}
+
+	constexpr T_* operator->() const noexcept(CHECK_NOTHROW) {
+		XEN_CHECK(_ptr != nullptr, err::Logic);
+		return _ptr;
+	}
 
 	constexpr operator bool() const noexcept { return _ptr != nullptr; }
 
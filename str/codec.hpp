@@ -0,0 +1,411 @@
+#pragma once
+
+#ifndef XEN_STR_CODEC
+#define XEN_STR_CODEC
+
+#include <span>
+
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+#include "str/str.hpp"
+#include "str/str_slice.hpp"
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+#include <immintrin.h>
+#define XEN_CODEC_SIMD
+#endif /// __SSSE3__ || __AVX2__
+
+namespace xen {
+
+/// @enum `base64_alphabet`
+/// @brief The character set used when encoding/decoding base64.
+/// @section Variants:
+/// - Standard: RFC 4648 section 4 (`+`, `/`), output is padded with `=`.
+/// - UrlSafe : RFC 4648 section 5 (`-`, `_`), output is not padded.
+enum class base64_alphabet: u8_t {
+	Standard,
+	UrlSafe,
+};
+
+/// @class `base64`
+/// @brief Conversion between binary byte spans and base64 text.
+/// @section Features:
+/// - Encoded `str` is allocated once with its exact final length.
+/// - Decoding writes straight into a caller provided buffer (no intermediate `str`).
+/// - Uses SSSE3 shuffle kernels (16 chars per step) when available, scalar tables otherwise.
+/// - Decoding accepts both padded and unpadded input for either alphabet.
+/// - Reports errors via the `err` enumeration:
+/// --> `err::InvalidArgument` : Input contains a character outside the alphabet or has an impossible length.
+/// --> `err::IndexOutOfRange` : Output buffer is smaller than `decoded_len(...)`.
+class base64 {
+private:
+	static constexpr u8_t _INVALID = 0xFF;
+
+#pragma region /// Helpers
+
+	[[nodiscard]] static constexpr const char* _alphabet(base64_alphabet alpha) noexcept {
+		return alpha == base64_alphabet::Standard
+			? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+			: "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+	}
+
+	struct _decode_table {
+		u8_t val[256];
+
+		constexpr _decode_table(base64_alphabet alpha) noexcept : val{} {
+			for (u64_t i = 0; i < 256; ++i) val[i] = _INVALID;
+
+			const char* chars = _alphabet(alpha);
+			for (u8_t i = 0; i < 64; ++i) val[static_cast<u8_t>(chars[i])] = i;
+		}
+	};
+
+	[[nodiscard]] static const _decode_table& _table(base64_alphabet alpha) noexcept {
+		static constexpr _decode_table STANDARD {base64_alphabet::Standard};
+		static constexpr _decode_table URL_SAFE {base64_alphabet::UrlSafe};
+		return alpha == base64_alphabet::Standard ? STANDARD : URL_SAFE;
+	}
+
+	/// @returns no.of meaningful characters in `text` (trailing `=` stripped)
+	[[nodiscard]] static constexpr u64_t _strip_padding(const char* text, u64_t len) noexcept {
+		if (len > 0 && text[len - 1] == '=') --len;
+		if (len > 0 && text[len - 1] == '=') --len;
+		return len;
+	}
+
+	static void _encode_scalar(const u8_t* in, u64_t in_len, char* out, const char* chars, bool pad) noexcept {
+		u64_t i = 0;
+		for (; i + 3 <= in_len; i += 3) {
+			const u32_t block = (u32_t{in[i]} << 16) | (u32_t{in[i + 1]} << 8) | u32_t{in[i + 2]};
+			*out++ = chars[(block >> 18) & 0x3F];
+			*out++ = chars[(block >> 12) & 0x3F];
+			*out++ = chars[(block >> 6) & 0x3F];
+			*out++ = chars[block & 0x3F];
+		}
+
+		const u64_t rem = in_len - i;
+		if (rem == 0) return;
+
+		const u32_t block = (u32_t{in[i]} << 16) | (rem == 2 ? u32_t{in[i + 1]} << 8 : 0u);
+		*out++ = chars[(block >> 18) & 0x3F];
+		*out++ = chars[(block >> 12) & 0x3F];
+		if (rem == 2) *out++ = chars[(block >> 6) & 0x3F];
+		else if (pad) *out++ = '=';
+		if (pad) *out++ = '=';
+	}
+
+	/// @returns no.of bytes written, throws `err::InvalidArgument` on a bad character
+	static u64_t _decode_scalar(const char* in, u64_t in_len, u8_t* out, const _decode_table& table) {
+		u8_t* out_it = out;
+		u64_t i = 0;
+
+		for (; i + 4 <= in_len; i += 4) {
+			const u8_t a = table.val[static_cast<u8_t>(in[i])];
+			const u8_t b = table.val[static_cast<u8_t>(in[i + 1])];
+			const u8_t c = table.val[static_cast<u8_t>(in[i + 2])];
+			const u8_t d = table.val[static_cast<u8_t>(in[i + 3])];
+			if ((a | b | c | d) & 0xC0) throw err::InvalidArgument;
+
+			const u32_t block = (u32_t{a} << 18) | (u32_t{b} << 12) | (u32_t{c} << 6) | u32_t{d};
+			*out_it++ = static_cast<u8_t>(block >> 16);
+			*out_it++ = static_cast<u8_t>(block >> 8);
+			*out_it++ = static_cast<u8_t>(block);
+		}
+
+		const u64_t rem = in_len - i;
+		if (rem == 0) return static_cast<u64_t>(out_it - out);
+		if (rem == 1) throw err::InvalidArgument;
+
+		const u8_t a = table.val[static_cast<u8_t>(in[i])];
+		const u8_t b = table.val[static_cast<u8_t>(in[i + 1])];
+		const u8_t c = rem == 3 ? table.val[static_cast<u8_t>(in[i + 2])] : u8_t{0};
+		if ((a | b | c) & 0xC0) throw err::InvalidArgument;
+
+		const u32_t block = (u32_t{a} << 18) | (u32_t{b} << 12) | (u32_t{c} << 6);
+		*out_it++ = static_cast<u8_t>(block >> 16);
+		if (rem == 3) *out_it++ = static_cast<u8_t>(block >> 8);
+
+		return static_cast<u64_t>(out_it - out);
+	}
+
+#ifdef XEN_CODEC_SIMD
+	/// @details Expands 12 bytes (of the 16 loaded) into 16 sextets, one per byte lane
+	[[nodiscard]] static __m128i _split_sextets(__m128i in) noexcept {
+		in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+		const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+		const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+		const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+		const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+		return _mm_or_si128(t1, t3);
+	}
+
+	/// @details Maps sextets to ascii by adding a per-range offset picked with `pshufb`
+	[[nodiscard]] static __m128i _sextets_to_ascii(__m128i idx, base64_alphabet alpha) noexcept {
+		const __m128i shift_lut = alpha == base64_alphabet::Standard
+			? _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+							'0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0)
+			: _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+							'0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0);
+
+		__m128i res = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+		const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), idx);
+		res = _mm_or_si128(res, _mm_and_si128(less, _mm_set1_epi8(13)));
+		return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, res), idx);
+	}
+
+	/// @returns no.of input bytes consumed, always a multiple of 12
+	static u64_t _encode_simd(const u8_t* in, u64_t in_len, char* out, base64_alphabet alpha) noexcept {
+		u64_t i = 0;
+		for (; i + 16 <= in_len; i += 12, out += 16) {
+			const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _sextets_to_ascii(_split_sextets(raw), alpha));
+		}
+
+		return i;
+	}
+
+	/// @returns no.of input chars consumed (multiple of 16), stops early at the first invalid block
+	static u64_t _decode_simd(const char* in, u64_t in_len, u8_t* out, u64_t out_cap, base64_alphabet alpha) noexcept {
+		const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+											0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+		const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+											0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+		const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+		const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+		u64_t i = 0, o = 0;
+		for (; i + 16 <= in_len && o + 16 <= out_cap; i += 16, o += 12) {
+			__m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+			if (alpha == base64_alphabet::UrlSafe) {
+				/// `+` and `/` are foreign to this alphabet, then fold `-`/`_` onto them
+				const __m128i foreign = _mm_or_si128(
+					_mm_cmpeq_epi8(chars, _mm_set1_epi8('+')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('/')));
+				if (_mm_movemask_epi8(foreign) != 0) break;
+
+				const __m128i dash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('-'));
+				const __m128i under = _mm_cmpeq_epi8(chars, _mm_set1_epi8('_'));
+				chars = _mm_sub_epi8(chars, _mm_and_si128(dash, _mm_set1_epi8('-' - '+')));
+				chars = _mm_sub_epi8(chars, _mm_and_si128(under, _mm_set1_epi8('_' - '/')));
+			}
+
+			const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), nibble_mask);
+			const __m128i lo_nibbles = _mm_and_si128(chars, nibble_mask);
+			const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+			const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+			if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0) break;
+
+			const __m128i eq_2f = _mm_cmpeq_epi8(chars, _mm_set1_epi8(0x2F));
+			const __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2f, hi_nibbles));
+			const __m128i sextets = _mm_add_epi8(chars, roll);
+
+			const __m128i merged = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+			const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+			const __m128i bytes = _mm_shuffle_epi8(packed,
+				_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), bytes);
+		}
+
+		return i;
+	}
+#endif /// XEN_CODEC_SIMD
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Sizes
+
+	/// @returns Exact no.of characters `encode` produces for `byte_len` bytes.
+	[[nodiscard]] static constexpr u_size encoded_len(u_size byte_len, base64_alphabet alpha = base64_alphabet::Standard) {
+		if (alpha == base64_alphabet::Standard) return (byte_len + 2) / 3 * 4;
+		return byte_len / 3 * 4 + (byte_len % 3 == 0 ? 0 : byte_len % 3 + 1);
+	}
+
+	/// @returns Exact no.of bytes `decode` writes for `text` (padding aware).
+	[[nodiscard]] static constexpr u_size decoded_len(str_slice text) noexcept {
+		const u64_t len = _strip_padding(text.data(), text.len());
+		return u_size{len / 4 * 3 + (len % 4 == 0 ? 0 : len % 4 - 1)};
+	}
+
+#pragma endregion /// Sizes
+#pragma region /// Conversion
+
+	/// @returns `bytes` encoded as base64 text
+	[[nodiscard]] static str encode(std::span<const u8_t> bytes, base64_alphabet alpha = base64_alphabet::Standard) {
+		str res = str::with_len(encoded_len(bytes.size(), alpha));
+		const u8_t* in = bytes.data();
+		char* out = res.begin();
+		u64_t done = 0;
+
+		#ifdef XEN_CODEC_SIMD
+		done = _encode_simd(in, bytes.size(), out, alpha);
+		#endif /// XEN_CODEC_SIMD
+
+		_encode_scalar(in + done, bytes.size() - done, out + done / 3 * 4, _alphabet(alpha), alpha == base64_alphabet::Standard);
+		return res;
+	}
+
+	/// @details Decodes base64 `text` (any `str`, `str_slice` or `\0` terminated text) into `out`
+	/// @returns no.of bytes written to `out`
+	static u_size decode(str_slice text, std::span<u8_t> out, base64_alphabet alpha = base64_alphabet::Standard) {
+		const u64_t len = _strip_padding(text.data(), text.len());
+		if (len % 4 == 1) throw err::InvalidArgument;
+		if (out.size() < decoded_len(text)) throw err::IndexOutOfRange;
+
+		const char* in = text.data();
+		u64_t done = 0;
+
+		#ifdef XEN_CODEC_SIMD
+		done = _decode_simd(in, len, out.data(), out.size(), alpha);
+		#endif /// XEN_CODEC_SIMD
+
+		return u_size{done / 4 * 3 + _decode_scalar(in + done, len - done, out.data() + done / 4 * 3, _table(alpha))};
+	}
+
+#pragma endregion /// Conversion
+};
+
+/// @class `hex`
+/// @brief Conversion between binary byte spans and base16 text.
+/// @section Features:
+/// - Encoded `str` is allocated once with its exact final length.
+/// - Decoding writes straight into a caller provided buffer and accepts either letter case.
+/// - Uses SSSE3 kernels (16 bytes per step) when available, scalar tables otherwise.
+/// - Reports errors via the `err` enumeration:
+/// --> `err::InvalidArgument` : Input contains a non hex digit or has an odd length.
+/// --> `err::IndexOutOfRange` : Output buffer is smaller than `decoded_len(...)`.
+class hex {
+private:
+#pragma region /// Helpers
+
+	[[nodiscard]] static constexpr const char* _digits(bool upper) noexcept {
+		return upper ? "0123456789ABCDEF" : "0123456789abcdef";
+	}
+
+	/// @returns nibble value of `c`, or `0xFF` if `c` is not a hex digit
+	[[nodiscard]] static constexpr u8_t _nibble(char c) noexcept {
+		if (c >= '0' && c <= '9') return static_cast<u8_t>(c - '0');
+		if (c >= 'a' && c <= 'f') return static_cast<u8_t>(c - 'a' + 10);
+		if (c >= 'A' && c <= 'F') return static_cast<u8_t>(c - 'A' + 10);
+		return 0xFF;
+	}
+
+#ifdef XEN_CODEC_SIMD
+	/// @returns no.of input bytes consumed (multiple of 16)
+	static u64_t _encode_simd(const u8_t* in, u64_t in_len, char* out, bool upper) noexcept {
+		const __m128i lut = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_digits(upper)));
+		const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+		u64_t i = 0;
+		for (; i + 16 <= in_len; i += 16, out += 32) {
+			const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+			const __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(raw, 4), nibble_mask));
+			const __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(raw, nibble_mask));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(hi, lo));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(hi, lo));
+		}
+
+		return i;
+	}
+
+	/// @returns 16 nibbles of `chars`, `valid` lanes are cleared for non hex digits
+	[[nodiscard]] static __m128i _to_nibbles(__m128i chars, __m128i& valid) noexcept {
+		const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+		const __m128i alpha = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+		const __m128i is_digit = _mm_and_si128(
+			_mm_cmpgt_epi8(digit, _mm_set1_epi8(-1)), _mm_cmplt_epi8(digit, _mm_set1_epi8(10)));
+		const __m128i is_alpha = _mm_and_si128(
+			_mm_cmpgt_epi8(alpha, _mm_set1_epi8(-1)), _mm_cmplt_epi8(alpha, _mm_set1_epi8(6)));
+
+		valid = _mm_or_si128(is_digit, is_alpha);
+		return _mm_or_si128(
+			_mm_and_si128(is_digit, digit), _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+	}
+
+	/// @returns no.of input chars consumed (multiple of 32), stops early at the first invalid block
+	static u64_t _decode_simd(const char* in, u64_t in_len, u8_t* out) noexcept {
+		const __m128i weights = _mm_set1_epi16(0x0110);
+
+		u64_t i = 0;
+		for (; i + 32 <= in_len; i += 32, out += 16) {
+			__m128i valid_a, valid_b;
+			const __m128i a = _to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), valid_a);
+			const __m128i b = _to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 16)), valid_b);
+			if (_mm_movemask_epi8(_mm_and_si128(valid_a, valid_b)) != 0xFFFF) break;
+
+			const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(a, weights), _mm_maddubs_epi16(b, weights));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), bytes);
+		}
+
+		return i;
+	}
+#endif /// XEN_CODEC_SIMD
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Sizes
+
+	/// @returns Exact no.of characters `encode` produces for `byte_len` bytes.
+	[[nodiscard]] static constexpr u_size encoded_len(u_size byte_len) { return byte_len * 2; }
+
+	/// @returns Exact no.of bytes `decode` writes for `text`.
+	[[nodiscard]] static constexpr u_size decoded_len(str_slice text) noexcept { return u_size{text.len() / 2}; }
+
+#pragma endregion /// Sizes
+#pragma region /// Conversion
+
+	/// @returns `bytes` encoded as hex text
+	[[nodiscard]] static str encode(std::span<const u8_t> bytes, bool upper = false) {
+		str res = str::with_len(encoded_len(bytes.size()));
+		const u8_t* in = bytes.data();
+		char* out = res.begin();
+		const char* digits = _digits(upper);
+		u64_t i = 0;
+
+		#ifdef XEN_CODEC_SIMD
+		i = _encode_simd(in, bytes.size(), out, upper);
+		#endif /// XEN_CODEC_SIMD
+
+		for (; i < bytes.size(); ++i) {
+			out[2 * i] = digits[in[i] >> 4];
+			out[2 * i + 1] = digits[in[i] & 0x0F];
+		}
+
+		return res;
+	}
+
+	/// @details Decodes hex `text` (any `str`, `str_slice` or `\0` terminated text) into `out`
+	/// @returns no.of bytes written to `out`
+	static u_size decode(str_slice text, std::span<u8_t> out) {
+		const u64_t len = text.len();
+		if (len % 2 != 0) throw err::InvalidArgument;
+		if (out.size() < decoded_len(text)) throw err::IndexOutOfRange;
+
+		const char* in = text.data();
+		u64_t i = 0;
+
+		#ifdef XEN_CODEC_SIMD
+		i = _decode_simd(in, len, out.data());
+		#endif /// XEN_CODEC_SIMD
+
+		for (; i < len; i += 2) {
+			const u8_t hi = _nibble(in[i]);
+			const u8_t lo = _nibble(in[i + 1]);
+			if ((hi | lo) & 0xF0) throw err::InvalidArgument;
+
+			out[i / 2] = static_cast<u8_t>((hi << 4) | lo);
+		}
+
+		return u_size{len / 2};
+	}
+
+#pragma endregion /// Conversion
+};
+
+} /// namespace xen
+
+#endif /// XEN_STR_CODEC
@@ -0,0 +1,77 @@
+#pragma once
+
+#ifndef XEN_PARSE
+#define XEN_PARSE
+
+#include <limits>
+#include <type_traits>
+
+#include "core/numdef.hpp"
+#include "core/safe_int.hpp"
+#include "err/err.hpp"
+#include "err/result.hpp"
+#include "str/str_slice.hpp"
+
+namespace xen {
+
+namespace _parse {
+
+/// @returns Value of the digit `ch` (`0-9`, `a-z`, `A-Z`), or `0xFF` if it isn't one
+[[nodiscard]] constexpr u8_t digit(char ch) noexcept {
+	if (ch >= '0' && ch <= '9') return static_cast<u8_t>(ch - '0');
+	if (ch >= 'a' && ch <= 'z') return static_cast<u8_t>(ch - 'a' + 10);
+	if (ch >= 'A' && ch <= 'Z') return static_cast<u8_t>(ch - 'A' + 10);
+	return 0xFF;
+}
+
+} /// namespace _parse
+
+/// @returns The integer spelled by the whole of `text` in `base` (2 .. 36), or the `err` it failed with. Never throws.
+/// @details Accepts an optional leading `-` (signed types only) or `+`, nothing else but digits.
+/// @note Failures are reported as:
+/// --> `err::InvalidArgument` : Empty text, a character which isn't a digit of `base`, or an unsupported `base`.
+/// --> `err::NumOverflow`     : The value exceeds maximum `T_` capacity.
+/// --> `err::NumUnderflow`    : The value goes below minimum `T_` capacity.
+template <typename T_>
+	requires int_operand<T_>
+[[nodiscard]] constexpr result<T_> parse_int(str_slice text, u8_t base = 10) noexcept {
+	if constexpr (is_safe_int_v<T_>) {
+		const result<typename T_::value_type> raw = parse_int<typename T_::value_type>(text, base);
+		if (raw.is_err()) [[unlikely]] return raw.get_err();
+		return T_{raw.get_val()};
+	} else {
+		if (base < 2 || base > 36) [[unlikely]] return err::InvalidArgument;
+
+		const char* it = text.begin();
+		const char* const END = text.end();
+
+		bool neg = false;
+		if (it != END && (*it == '-' || *it == '+')) neg = *it++ == '-';
+		if (it == END) [[unlikely]] return err::InvalidArgument;
+		if (neg && std::is_unsigned_v<T_>) [[unlikely]] return err::InvalidArgument;
+
+		/// largest magnitude the sign allows, `-min` fits `u64_t` for every signed type
+		constexpr u64_t MAX_MAG = static_cast<u64_t>(std::numeric_limits<T_>::max());
+		const u64_t limit = neg ? MAX_MAG + 1 : MAX_MAG;
+		const err past = neg ? err::NumUnderflow : err::NumOverflow;
+
+		u64_t mag = 0;
+		for (; it != END; ++it) {
+			const u8_t d = _parse::digit(*it);
+			if (d >= base) [[unlikely]] return err::InvalidArgument;
+			if (mag > (limit - d) / base) [[unlikely]] {
+				/// keep validating, a bad character outranks the range error
+				while (++it != END) if (_parse::digit(*it) >= base) return err::InvalidArgument;
+				return past;
+			}
+
+			mag = mag * base + d;
+		}
+
+		return static_cast<T_>(neg ? u64_t{0} - mag : mag);
+	}
+}
+
+} /// namespace xen
+
+#endif /// XEN_PARSE
@@ -3,8 +3,16 @@
 #ifndef XEN_STR
 #define XEN_STR
 
+#include <cstring>
+
+#include "core/config.hpp"
 #include "core/numdef.hpp"
 #include "core/safe_u64.hpp"
+#include "err/err.hpp"
+
+#ifdef XEN_USE_STR_POOL
+#include "str/str_pool.hpp"
+#endif /// XEN_USE_STR_POOL
 
 namespace xen {
 
@@ -26,6 +34,8 @@ namespace xen {
 /// - Supports ostream `<<` operator for displaying underlying string.
 /// - Comparison: conducts deep check of 2 `str` to verify similarity (==, !=)
 /// - Joins 2 `str` together to create a new `str`. (concat, +=, +)
+/// - Indexing (`[]`) checked per `XEN_CHECK_LEVEL`:
+/// --> `err::IndexOutOfRange` : Index at or past `len()`.
 class str {
 private:
 	char* _char_buf {nullptr};
@@ -42,12 +52,41 @@ private:
 		}
 	}
 
-	/// @details copies raw c-style string to self
-	void _copy_text(const char* text) noexcept {
+	/// @details Allocates `_char_buf` for `len` characters (+ `\0`)
+	/// @warning `_char_buf` must be released before calling
+	constexpr void _alloc_buf(u_size len) {
+		_len = len;
+
+		#ifdef XEN_USE_STR_POOL
+		if (!std::is_constant_evaluated()) {
+			_char_buf = str_pool::acquire(len + 1);
+			return;
+		}
+		#endif /// XEN_USE_STR_POOL
+
+		_char_buf = new char[len + 1];
+	}
+
+	/// @details Releases `_char_buf` and resets self to empty
+	constexpr void _free_buf() noexcept {
+		#ifdef XEN_USE_STR_POOL
+		if (!std::is_constant_evaluated()) {
+			str_pool::release(_char_buf, _len + 1);
+			_char_buf = nullptr;
+			_len = 0;
+			return;
+		}
+		#endif /// XEN_USE_STR_POOL
+
 		delete[] _char_buf;
+		_char_buf = nullptr;
+		_len = 0;
+	}
 
-		_len = get_text_len(text);
-		_char_buf = new char[_len + 1];
+	/// @details copies raw c-style string to self
+	void _copy_text(const char* text) noexcept {
+		_free_buf();
+		_alloc_buf(get_text_len(text));
 		_raw_copy_text(_char_buf, text);
 	}
 
@@ -62,22 +101,35 @@ public:
 		_copy_text(text == nullptr ? "" : text);
 	}
 
-	constexpr ~str() noexcept { delete[] _char_buf; }
+	constexpr ~str() noexcept { _free_buf(); }
+
+	/// @details Allocates a buffer of exactly `len` characters (+ `\0`) in one go
+	/// @warning Characters are left uninitialized, fill them through `begin()`
+	[[nodiscard]] static str with_len(u_size len) {
+		str s {};
+		if (len == 0) return s;
+
+		s._alloc_buf(len);
+		s._char_buf[len] = '\0';
+		return s;
+	}
 
 #pragma endregion /// Constrctors
 #pragma region /// Copy semantics
 
 	[[nodiscard]] constexpr str(const str& other) noexcept {
-		_len = other._len;
-		_char_buf = new char[_len + 1];
+		if (other._char_buf == nullptr) return;
+
+		_alloc_buf(other._len);
 		_raw_copy_text(_char_buf, other.c_str());
 	}
 	
 	constexpr str& operator=(const str& other) noexcept {
 		if (&other != this) [[likely]] {
 			reset();
-			_len = other._len;
-			_char_buf = new char[_len + 1];
+			if (other._char_buf == nullptr) return *this;
+
+			_alloc_buf(other._len);
 			_raw_copy_text(_char_buf, other.c_str());
 		}
 
@@ -97,6 +149,7 @@ public:
 
 	constexpr str& operator=(str&& other) noexcept {
 		if (&other != this) [[likely]] {
+			_free_buf();
 			_len = other._len;
 			_char_buf = other._char_buf;
 
@@ -148,13 +201,24 @@ public:
 	[[nodiscard]] constexpr bool is_empty() const noexcept { return _len == 0; }
 
 	/// @details Clears character buffer
-	constexpr void reset() noexcept {
-		_len = 0;
-		delete[] _char_buf;
-		_char_buf = nullptr;
-	}
+	constexpr void reset() noexcept { _free_buf(); }
 
 #pragma endregion /// String utils
+#pragma region /// Indexing
+
+	/// @returns Character at `idx`
+	[[nodiscard]] constexpr char& operator[](u_size idx) noexcept(CHECK_NOTHROW) {
+		XEN_CHECK(idx < _len, err::IndexOutOfRange);
+		return _char_buf[idx];
+	}
+
+	/// @returns Character at `idx`
+	[[nodiscard]] constexpr const char& operator[](u_size idx) const noexcept(CHECK_NOTHROW) {
+		XEN_CHECK(idx < _len, err::IndexOutOfRange);
+		return _char_buf[idx];
+	}
+
+#pragma endregion /// Indexing
 #pragma region /// Comparison operator
 
 	friend bool operator==(const str& lhs, const str& rhs) {
@@ -174,16 +238,16 @@ public:
 #pragma region /// Concatenation
 
 	/// @returns Joins two strings into one and returns it
-	constexpr static str concat(const str& lhs, const str& rhs) {
+	/// @note Prefer `xen::join` (str/str_slice.hpp) when joining many strings
+	static str concat(const str& lhs, const str& rhs) {
 		u_size new_len {lhs.len() + rhs.len()};
 		if (new_len == 0) return str {};
 
 		str s {};
-		s._len = new_len;
-		s._char_buf = new char[new_len + 1];
+		s._alloc_buf(new_len);
 
-		for (u_size i = 0; i < lhs.len(); i++) s._char_buf[i] = lhs._char_buf[i];
-		for (u_size i = 0; i < rhs.len(); i++) s._char_buf[lhs.len() + i] = rhs._char_buf[i];
+		if (!lhs.is_empty()) std::memcpy(s._char_buf, lhs._char_buf, lhs.len());
+		if (!rhs.is_empty()) std::memcpy(s._char_buf + lhs.len(), rhs._char_buf, rhs.len());
 
 		s._char_buf[new_len] = '\0';
 		return s;
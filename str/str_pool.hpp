@@ -0,0 +1,156 @@
+#pragma once
+
+#ifndef XEN_STR_POOL
+#define XEN_STR_POOL
+
+#include <atomic>
+#include <bit>
+#include <new>
+
+#include "core/numdef.hpp"
+
+namespace xen {
+
+/// @struct `str_pool_stats`
+/// @brief Counters of the calling thread's `str_pool`.
+struct str_pool_stats {
+	u64_t hits {0};     /// Acquires served from a free list
+	u64_t misses {0};   /// Acquires that had to reach the global allocator
+	u64_t recycled {0}; /// Releases kept on a free list
+	u64_t dropped {0};  /// Releases freed because the free list was at its cap
+	u64_t cached {0};   /// Buffers currently held on the free lists
+};
+
+/// @class `str_pool`
+/// @brief A thread-local, size-classed free list of character buffers.
+/// @warning Only used by `str` when `XEN_USE_STR_POOL` is defined (see core/config.hpp)
+/// @section Features:
+/// - Buffers are rounded up to power of two size classes (16 .. 2048 bytes).
+/// - Larger buffers bypass the pool and go straight to the global allocator.
+/// - Each thread owns its free lists, so acquire/release never synchronise.
+/// - No.of cached buffers per size class is capped (`set_cap`), shared by all threads.
+/// - Cached buffers are freed when their thread exits or on `trim()`.
+class str_pool {
+private:
+	static constexpr u64_t _MIN_CLASS_SHIFT = 4;
+	static constexpr u64_t _CLASS_COUNT = 8;
+	static constexpr u64_t _MAX_CLASS_SIZE = u64_t{1} << (_MIN_CLASS_SHIFT + _CLASS_COUNT - 1);
+
+	struct _node { _node* next; };
+
+	struct _thread_state {
+		_node* heads[_CLASS_COUNT] {};
+		u64_t counts[_CLASS_COUNT] {};
+		str_pool_stats stats {};
+
+		~_thread_state() noexcept {
+			trim();
+			_exited = true;
+		}
+
+		void trim() noexcept {
+			for (u64_t i = 0; i < _CLASS_COUNT; ++i) {
+				while (heads[i] != nullptr) {
+					_node* node = heads[i];
+					heads[i] = node->next;
+					delete[] reinterpret_cast<char*>(node);
+				}
+
+				counts[i] = 0;
+			}
+
+			stats.cached = 0;
+		}
+	};
+
+	static inline std::atomic<u64_t> _cap {64};
+
+	/// @details Set once the thread's state is gone, late releases (thread_local `str`s) bypass the pool
+	static inline thread_local bool _exited {false};
+
+#pragma region /// Helpers
+
+	[[nodiscard]] static _thread_state& _local() noexcept {
+		thread_local _thread_state state {};
+		return state;
+	}
+
+	/// @returns index of the smallest size class holding `size` bytes
+	[[nodiscard]] static constexpr u64_t _class_of(u64_t size) noexcept {
+		if (size <= (u64_t{1} << _MIN_CLASS_SHIFT)) return 0;
+		return static_cast<u64_t>(std::bit_width(size - 1)) - _MIN_CLASS_SHIFT;
+	}
+
+	[[nodiscard]] static constexpr u64_t _class_size(u64_t idx) noexcept {
+		return u64_t{1} << (idx + _MIN_CLASS_SHIFT);
+	}
+
+#pragma endregion /// Helpers
+
+public:
+#pragma region /// Buffers
+
+	/// @returns A buffer holding at least `size` characters
+	/// @warning Must be given back through `release(buf, size)` with the same `size`
+	[[nodiscard]] static char* acquire(u64_t size) {
+		if (size > _MAX_CLASS_SIZE) return new char[size];
+
+		const u64_t idx = _class_of(size);
+		_thread_state& state = _local();
+
+		if (_node* node = state.heads[idx]; node != nullptr) [[likely]] {
+			state.heads[idx] = node->next;
+			--state.counts[idx];
+			--state.stats.cached;
+			++state.stats.hits;
+			return reinterpret_cast<char*>(node);
+		}
+
+		++state.stats.misses;
+		return new char[_class_size(idx)];
+	}
+
+	/// @details Hands `buf` back to the calling thread's free list, or frees it if full
+	static void release(char* buf, u64_t size) noexcept {
+		if (buf == nullptr) return;
+		if (size > _MAX_CLASS_SIZE || _exited) [[unlikely]] {
+			delete[] buf;
+			return;
+		}
+
+		const u64_t idx = _class_of(size);
+		_thread_state& state = _local();
+
+		if (state.counts[idx] >= _cap.load(std::memory_order_relaxed)) {
+			++state.stats.dropped;
+			delete[] buf;
+			return;
+		}
+
+		state.heads[idx] = ::new (buf) _node{state.heads[idx]};
+		++state.counts[idx];
+		++state.stats.cached;
+		++state.stats.recycled;
+	}
+
+	/// @details Frees every buffer cached by the calling thread
+	static void trim() noexcept { _local().trim(); }
+
+#pragma endregion /// Buffers
+#pragma region /// Configuration
+
+	/// @details Sets the max no.of cached buffers per size class (per thread)
+	static void set_cap(u64_t cap) noexcept { _cap.store(cap, std::memory_order_relaxed); }
+
+	/// @returns The max no.of cached buffers per size class (per thread)
+	[[nodiscard]] static u64_t get_cap() noexcept { return _cap.load(std::memory_order_relaxed); }
+
+	/// @returns Counters of the calling thread
+	[[nodiscard]] static str_pool_stats get_stats() noexcept { return _local().stats; }
+
+#pragma endregion /// Configuration
+};
+
+} /// namespace xen
+
+#endif /// XEN_STR_POOL
@@ -0,0 +1,147 @@
+#pragma once
+
+#ifndef XEN_STR_SLICE
+#define XEN_STR_SLICE
+
+#include <cstring>
+#include <iterator>
+
+#include "core/config.hpp"
+#include "core/numdef.hpp"
+#include "core/safe_u64.hpp"
+#include "err/err.hpp"
+#include "str/str.hpp"
+
+namespace xen {
+
+/// @class `str_slice`
+/// @brief A non owning view over a run of characters.
+/// @warning The viewed characters must outlive the slice, and are not `\0` terminated
+/// @section Features:
+/// - Constructs from `str`, `const char*` or a raw pointer and length without copying.
+/// - Cheap to copy, just a pointer and a length.
+/// - Indexing (`[]`) and sub-slicing with bounds checking per `XEN_CHECK_LEVEL` (`err::IndexOutOfRange`).
+/// - Comparison: conducts deep check of 2 slices to verify similarity (==, !=)
+/// - Supports ostream `<<` operator for displaying the viewed characters.
+class str_slice {
+private:
+	const char* _ptr {nullptr};
+	u_size _len {0};
+
+public:
+#pragma region /// Constructors
+
+	[[nodiscard]] constexpr str_slice() noexcept = default;
+
+	[[nodiscard]] constexpr str_slice(const char* ptr, u_size len) noexcept : _ptr{ptr}, _len{len} {}
+
+	[[nodiscard]] str_slice(const char* text) noexcept
+	: _ptr{text}, _len{text == nullptr ? u_size{0} : get_text_len(text)} {}
+
+	[[nodiscard]] constexpr str_slice(const str& text) noexcept : _ptr{text.c_str()}, _len{text.len()} {}
+
+#pragma endregion /// Constructors
+	#ifdef _OSTREAM_
+	/// @details Console logging support
+	friend std::ostream& operator<<(std::ostream& os, const str_slice& slice) noexcept {
+		os.write(slice._ptr, static_cast<std::streamsize>(static_cast<u64_t>(slice._len)));
+		return os;
+	}
+	#endif /// _OSTREAM_
+#pragma region /// Iterator
+
+	/// @returns const iterator to the start of the slice
+	constexpr const char* begin() const noexcept { return _ptr; }
+
+	/// @returns const iterator to the end of the slice
+	constexpr const char* end() const noexcept { return _ptr + _len; }
+
+#pragma endregion /// Iterator
+#pragma region /// Slice utils
+
+	/// @returns Pointer to the first viewed character.
+	[[nodiscard]] constexpr const char* data() const noexcept { return _ptr; }
+
+	/// @returns Total no.of characters in the slice.
+	[[nodiscard]] constexpr u_size len() const noexcept { return _len; }
+
+	/// @returns `true` if slice is empty.
+	[[nodiscard]] constexpr bool is_empty() const noexcept { return _len == 0; }
+
+	/// @returns Character at `idx`
+	[[nodiscard]] constexpr const char& operator[](u_size idx) const noexcept(CHECK_NOTHROW) {
+		XEN_CHECK(idx < _len, err::IndexOutOfRange);
+		return _ptr[idx];
+	}
+
+	/// @returns Slice of `count` characters starting at `start`
+	[[nodiscard]] constexpr str_slice sub(u_size start, u_size count) const noexcept(CHECK_NOTHROW) {
+		XEN_CHECK(start <= _len && count <= _len - start, err::IndexOutOfRange);
+		return str_slice{_ptr + start, count};
+	}
+
+	/// @returns Owning copy of the viewed characters
+	[[nodiscard]] str to_str() const {
+		str s = str::with_len(_len);
+		if (_len != 0) std::memcpy(s.begin(), _ptr, _len);
+		return s;
+	}
+
+#pragma endregion /// Slice utils
+#pragma region /// Comparison operator
+
+	friend bool operator==(const str_slice& lhs, const str_slice& rhs) noexcept {
+		if (lhs._len != rhs._len) return false;
+		if (lhs._ptr == rhs._ptr || lhs._len == 0) return true;
+
+		return std::memcmp(lhs._ptr, rhs._ptr, lhs._len) == 0;
+	}
+
+	friend bool operator!=(const str_slice& lhs, const str_slice& rhs) noexcept { return !(lhs == rhs); }
+
+#pragma endregion /// Comparison operator
+};
+
+/// @returns Every element of `parts` joined together with `sep` in between
+/// @details Lengths are summed up front so the result is allocated exactly once,
+/// then every part is bulk copied into place.
+template <typename R_>
+	requires requires (const R_& parts) {
+		{ str_slice{*std::begin(parts)} };
+		{ std::end(parts) };
+	}
+[[nodiscard]] str join(const R_& parts, str_slice sep = str_slice{}) {
+	u_size total {0};
+	u_size count {0};
+
+	for (const auto& part : parts) {
+		total += str_slice{part}.len();
+		++count;
+	}
+
+	if (count == 0) return str{};
+	total += sep.len() * (count - 1);
+
+	str res = str::with_len(total);
+	char* out = res.begin();
+	bool first = true;
+
+	for (const auto& part : parts) {
+		if (!first && !sep.is_empty()) {
+			std::memcpy(out, sep.data(), sep.len());
+			out += sep.len();
+		}
+
+		const str_slice slice {part};
+		if (!slice.is_empty()) std::memcpy(out, slice.data(), slice.len());
+
+		out += slice.len();
+		first = false;
+	}
+
+	return res;
+}
+
+} /// namespace xen
+
+#endif /// XEN_STR_SLICE
@@ -0,0 +1,50 @@
+/// `atomic_safe_u64` never loses a failure when threads race at its limits
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "core/atomic_safe_u64.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// @returns The sum of what every successful `op(i)` call returned, `threads` threads each trying `tries` times
+template <typename F_>
+static u64_t race(u64_t threads, u64_t tries, F_ op) {
+	std::atomic<u64_t> done {0};
+	std::vector<std::thread> workers;
+
+	for (u64_t t = 0; t < threads; ++t) {
+		workers.emplace_back([&] {
+			for (u64_t i = 0; i < tries; ++i) {
+				try { done.fetch_add(op(i), std::memory_order_relaxed); } catch (err) {}
+			}
+		});
+	}
+
+	for (std::thread& worker : workers) worker.join();
+	return done.load();
+}
+
+int main() {
+	constexpr u64_t ROOM = 1000;
+
+	/// every thread alternates adds of 1 and 3 until `ROOM` is used up, no add is lost or half applied
+	atomic_safe_u64 high {safe_u64{U64_MAX - ROOM}};
+	const u64_t added = race(4, 2000, [&high](u64_t i) {
+		const u64_t step = i % 2 == 0 ? 1 : 3;
+		high.fetch_add(step);
+		return step;
+	});
+	XEN_TEST_CHECK(added <= ROOM && ROOM - added < 3 && high.load() == U64_MAX - ROOM + added);
+
+	atomic_safe_u64 low {safe_u64{ROOM}};
+	const u64_t taken = race(4, 2000, [&low](u64_t) { low.fetch_sub(1); return 1; });
+	XEN_TEST_CHECK(taken == ROOM && low.load() == 0u);
+
+	XEN_TEST_THROWS(high.fetch_add(ROOM + 1), err::NumOverflow);
+	XEN_TEST_THROWS(low.fetch_sub(1), err::NumUnderflow);
+	XEN_TEST_THROWS(high.fetch_mul(2), err::NumOverflow);
+	return 0;
+}
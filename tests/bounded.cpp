@@ -0,0 +1,70 @@
+/// `bounded` widens result ranges at compile time, and only checks at runtime once a range leaves `i64_t`
+
+#include <limits>
+#include <type_traits>
+
+#include "core/bounded.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+constexpr i64_t I64_LOW = std::numeric_limits<i64_t>::min();
+constexpr i64_t I64_HIGH = std::numeric_limits<i64_t>::max();
+
+/// smallest storage holding the range
+static_assert(sizeof(bounded<0, 99>) == 1 && sizeof(bounded<-1, 127>) == 1 && sizeof(bounded<0, 256>) == 2);
+static_assert(std::is_same_v<bounded<-129, 0>::value_type, i16_t> && std::is_same_v<bounded<0, U32_MAX>::value_type, u32_t>);
+static_assert(std::is_same_v<bounded<I64_LOW, 0>::value_type, i64_t> && std::is_same_v<bounded<0, I64_HIGH>::value_type, u64_t>);
+
+/// result ranges, from every corner of the operand ranges
+using idx_t = bounded<0, 99>;
+using stride_t = bounded<1, 8>;
+using delta_t = bounded<-3, 5>;
+static_assert(std::is_same_v<decltype(idx_t{} + stride_t{1}), bounded<1, 107>>);
+static_assert(std::is_same_v<decltype(idx_t{} - stride_t{1}), bounded<-8, 98>>);
+static_assert(std::is_same_v<decltype(idx_t{} * stride_t{1} + delta_t{}), bounded<-3, 797>>);
+static_assert(std::is_same_v<decltype(delta_t{} * delta_t{}), bounded<-15, 25>>);
+static_assert(std::is_same_v<decltype(bounded<-4, -2>{-3} * bounded<-5, 3>{0}), bounded<-12, 20>>);
+
+/// in range results need no check, results past `i64_t` do
+using wide_t = bounded<0, I64_HIGH>;
+using neg_t = bounded<I64_LOW, 0>;
+static_assert(noexcept(idx_t{} * stride_t{} + delta_t{}) && noexcept(neg_t{} - bounded_c<0>));
+static_assert(!noexcept(wide_t{} + bounded_c<1>) && !noexcept(neg_t{} - bounded_c<1>) && !noexcept(wide_t{} * bounded_c<2>));
+static_assert(std::is_same_v<decltype(wide_t{} + bounded_c<1>), bounded<1, I64_HIGH>>);
+
+/// conversions: free when widening, explicit & checked when narrowing
+static_assert(std::is_convertible_v<bounded<1, 8>, bounded<0, 99>> && !std::is_convertible_v<bounded<0, 99>, bounded<1, 8>>);
+static_assert(!std::is_convertible_v<int, idx_t> && std::is_constructible_v<idx_t, int>);
+
+/// defaults to the value closest to zero
+static_assert(idx_t{}.get() == 0 && bounded<3, 9>{}.get() == 3 && bounded<-9, -3>{}.get() == -3);
+
+/// computed at compile time too
+static_assert((idx_t{7} * stride_t{8} + delta_t{-3}).get() == 53);
+
+int main() {
+	const idx_t i {42};
+	const stride_t stride {4};
+	const delta_t off {-3};
+	XEN_TEST_CHECK((i * stride + off).get() == 165 && (off - i).get() == -45);
+	XEN_TEST_CHECK(i + bounded_c<8> == bounded_c<50> && i - bounded_c<50> < bounded_c<0>);
+	XEN_TEST_CHECK(bounded<-5, 5>{-1} < idx_t{0} && idx_t{99} > bounded<-5, 5>{5} && (idx_t{3} <=> stride_t{3}) == 0);
+
+	/// checked construction
+	XEN_TEST_THROWS(idx_t{100}, err::NumOverflow);
+	XEN_TEST_THROWS(idx_t{-1}, err::NumUnderflow);
+	XEN_TEST_THROWS(idx_t{U64_MAX}, err::NumOverflow);
+	XEN_TEST_THROWS(stride_t{idx_t{0}}, err::NumUnderflow);
+	XEN_TEST_THROWS(stride_t{idx_t{9}}, err::NumOverflow);
+	XEN_TEST_CHECK(stride_t{idx_t{8}}.get() == 8 && idx_t{stride_t{8}}.get() == 8);
+
+	/// past `i64_t` the result is checked at runtime
+	const wide_t big {I64_HIGH - 1};
+	XEN_TEST_CHECK((big + bounded_c<1>).get() == static_cast<u64_t>(I64_HIGH));
+	XEN_TEST_THROWS(big + bounded_c<2>, err::NumOverflow);
+	XEN_TEST_THROWS(big * bounded_c<2>, err::NumOverflow);
+	XEN_TEST_THROWS(neg_t{I64_LOW} - bounded_c<1>, err::NumUnderflow);
+	XEN_TEST_CHECK((neg_t{I64_LOW + 1} - bounded_c<1>).get() == I64_LOW);
+	return 0;
+}
@@ -0,0 +1,65 @@
+/// Behaviour of every `XEN_CHECK_LEVEL`, built once per level (see tests/CMakeLists.txt)
+
+#undef NDEBUG
+
+#include <csignal>
+
+#include "core/checked.hpp"
+#include "core/safe_u64.hpp"
+#include "mem/observed_ref.hpp"
+#include "mem/shared_ref.hpp"
+#include "mem/unique_ref.hpp"
+#include "str/str_slice.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+int main() {
+	str text {"hello"};
+	const str_slice slice {text};
+	unique_ref<int> unique {new int{3}};
+	shared_ref<int> shared {new int{4}};
+	observed_ref<int> observed {new int{5}};
+
+	/// in range use is unaffected by the level
+	XEN_TEST_CHECK(text[0] == 'h' && slice[4] == 'o' && slice.sub(1, 3)[2] == 'l');
+	XEN_TEST_CHECK(*unique == 3 && *shared == 4 && *observed == 5);
+	XEN_TEST_CHECK(safe_u64{2} + 3 == 5u);
+
+	/// APIs which exist to report errors check at every level
+	XEN_TEST_CHECK(checked_add(safe_u64{U64_MAX}, 1).get_err() == err::NumOverflow);
+
+	#if XEN_CHECK_LEVEL == XEN_CHECK_FULL
+	static_assert(!CHECK_NOTHROW && !noexcept(text[0]) && !noexcept(*unique));
+	static_assert(std::is_same_v<safe_u64::policy_type, overflow::throw_err>);
+
+	XEN_TEST_THROWS(text[5], err::IndexOutOfRange);
+	XEN_TEST_THROWS(slice[5], err::IndexOutOfRange);
+	XEN_TEST_THROWS(slice.sub(3, 3), err::IndexOutOfRange);
+	XEN_TEST_THROWS(*unique_ref<int>{}, err::Logic);
+	XEN_TEST_THROWS(*shared_ref<int>{}, err::Logic);
+	XEN_TEST_THROWS(*observed_ref<int>{}, err::Logic);
+	XEN_TEST_THROWS(safe_u64{U64_MAX} + 1, err::NumOverflow);
+	XEN_TEST_THROWS(safe_u64{0} - 1, err::NumUnderflow);
+	#elif XEN_CHECK_LEVEL == XEN_CHECK_DEBUG
+	static_assert(CHECK_NOTHROW && noexcept(text[0]) && noexcept(*unique) && noexcept(slice.sub(0, 1)));
+	static_assert(std::is_same_v<safe_u64::policy_type, overflow::debug_assert>);
+
+	#ifdef XEN_TEST_TRIP
+	/// the failed check must `assert`, the abort is the pass
+	std::signal(SIGABRT, [](int) { std::_Exit(0); });
+	(void)text[5];
+	return 1;
+	#endif /// XEN_TEST_TRIP
+	#else
+	static_assert(CHECK_NOTHROW && noexcept(text[0]) && noexcept(*unique) && noexcept(slice.sub(0, 1)));
+	static_assert(std::is_same_v<safe_u64::policy_type, overflow::wrap>);
+
+	/// no checking code at all, failures wrap like the raw integer
+	safe_u64 val {U64_MAX};
+	++val;
+	XEN_TEST_CHECK(val == 0u);
+	#endif /// XEN_CHECK_LEVEL
+
+	return 0;
+}
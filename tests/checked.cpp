@@ -0,0 +1,69 @@
+/// `checked_*` return their failure instead of throwing, `sticky_int` latches the first one
+
+#include "core/checked.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+static_assert(noexcept(checked_add(safe_u64{}, 1)) && noexcept(sticky_u64{} += 1));
+static_assert(sizeof(sticky_int<u32_t>) == sizeof(result<u32_t>) && sizeof(sticky_int<u8_t>) == 2);
+
+/// usable in constant expressions
+static_assert(checked_mul(safe_u8{16}, 16).get_err() == err::NumOverflow && checked_add(safe_u8{1}, 2).get_val() == 3);
+
+int main() {
+	/// results, never throws
+	XEN_TEST_CHECK(checked_add(safe_u64{U64_MAX - 1}, 1).get_val() == U64_MAX);
+	XEN_TEST_CHECK(checked_add(safe_u64{U64_MAX}, 1).get_err() == err::NumOverflow);
+	XEN_TEST_CHECK(checked_add(safe_u64{5}, -5).get_val() == 0u && checked_add(safe_u64{5}, -6).get_err() == err::NumUnderflow);
+	XEN_TEST_CHECK(checked_sub(safe_i8{-100}, 28).get_val() == -128 && checked_sub(safe_i8{-100}, 29).get_err() == err::NumUnderflow);
+	XEN_TEST_CHECK(checked_sub(safe_u32{3}, safe_u32{4}).get_err() == err::NumUnderflow);
+	XEN_TEST_CHECK(checked_mul(safe_u64{u64_t{1} << 32}, u64_t{1} << 31).get_val() == u64_t{1} << 63);
+	XEN_TEST_CHECK(checked_mul(safe_u64{u64_t{1} << 32}, u64_t{1} << 32).get_err() == err::NumOverflow);
+	XEN_TEST_CHECK(checked_mul(safe_i64{0}, -1).get_val() == 0);
+	XEN_TEST_CHECK(checked_div(safe_u64{9}, 0).get_err() == err::DivideByZero && checked_div(safe_u64{9}, 4).get_val() == 2u);
+	XEN_TEST_CHECK(checked_div(safe_i64{std::numeric_limits<i64_t>::min()}, -1).get_err() == err::NumOverflow);
+
+	/// the product is 128-bit wide, only the final result must fit
+	XEN_TEST_CHECK(checked_mul_div(safe_u64{U64_MAX}, U64_MAX, U64_MAX).get_val() == U64_MAX);
+	XEN_TEST_CHECK(checked_mul_div(safe_u64{U64_MAX}, 2, 1).get_err() == err::NumOverflow);
+	XEN_TEST_CHECK(checked_mul_div(safe_u64{1}, 1, 0).get_err() == err::DivideByZero);
+	XEN_TEST_CHECK(checked_mul_add(safe_u64{U64_MAX / 2}, 2, 1).get_val() == U64_MAX);
+	XEN_TEST_CHECK(checked_mul_add(safe_u64{U64_MAX / 2}, 2, 2).get_err() == err::NumOverflow);
+
+	/// the policy of the operand carries over to the result
+	const result<safe_int<u8_t, overflow::saturate>> sat = checked_add(safe_int<u8_t, overflow::saturate>{1}, 1);
+	XEN_TEST_CHECK(sat.get_val() + 300 == 255);
+
+	/// `sticky_int`: runs a batch, checks it once
+	sticky_u64 total {10};
+	total += 5;
+	total *= 2;
+	total -= 30;
+	total /= 7;
+	XEN_TEST_CHECK(total.is_ok() && total.get_result().get_val() == 0u);
+
+	/// the first failure is kept, later operations are no-ops
+	total += U64_MAX;
+	total += 1;
+	total -= U64_MAX;
+	total /= 0;
+	XEN_TEST_CHECK(!total.is_ok() && total.get_result().get_err() == err::NumOverflow);
+
+	total.reset(4);
+	total -= 5;
+	total *= 0;
+	XEN_TEST_CHECK(total.get_result().get_err() == err::NumUnderflow);
+	total.reset();
+	total /= 0;
+	XEN_TEST_CHECK(total.get_result().get_err() == err::DivideByZero);
+
+	/// signed, and constructed from out of range values clamped
+	sticky_int<i8_t> small {-1000};
+	XEN_TEST_CHECK(small.get_result().get_val() == -128);
+	small += safe_u8{255};
+	XEN_TEST_CHECK(small.get_result().get_val() == 127);
+	small -= 300;
+	XEN_TEST_CHECK(small.get_result().get_err() == err::NumUnderflow);
+	return 0;
+}
@@ -0,0 +1,20 @@
+/// `checked_*` reductions report overflow at every `XEN_CHECK_LEVEL`, also when only combining two batches overflows
+
+#include <vector>
+
+#include "core/checked_reduce.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+int main() {
+	std::vector<u64_t> data(_checked_reduce::BATCH + 1, 0);
+	data[0] = U64_MAX;
+	XEN_TEST_CHECK(checked_sum(data) == U64_MAX);
+	XEN_TEST_CHECK(checked_dot(data, std::vector<u64_t>(data.size(), 1)) == U64_MAX);
+
+	data.back() = 1;
+	XEN_TEST_THROWS(checked_sum(data), err::NumOverflow);
+	XEN_TEST_THROWS(checked_dot(data, std::vector<u64_t>(data.size(), 1)), err::NumOverflow);
+	return 0;
+}
@@ -0,0 +1,36 @@
+/// `base64` / `hex` decode straight from slices of a larger text, without copying them into a `str`
+
+#include <cstring>
+
+#include "str/codec.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+int main() {
+	u8_t bytes[48];
+	for (u64_t i = 0; i < sizeof(bytes); ++i) bytes[i] = static_cast<u8_t>(i * 37 + 11);
+
+	/// the encoded text framed by unrelated characters, the slices end before them
+	const str b64 = base64::encode(bytes);
+	const str b64_framed = str{"<"} + b64 + str{"!!>"};
+	const str_slice b64_view = str_slice{b64_framed}.sub(1, b64.len());
+
+	u8_t out[48] {};
+	XEN_TEST_CHECK(base64::decoded_len(b64_view) == sizeof(bytes));
+	XEN_TEST_CHECK(base64::decode(b64_view, out) == sizeof(bytes) && std::memcmp(out, bytes, sizeof(bytes)) == 0);
+
+	const str hx = hex::encode(bytes);
+	const str hx_framed = str{"["} + hx + str{"zz]"};
+	const str_slice hx_view = str_slice{hx_framed}.sub(1, hx.len());
+
+	std::memset(out, 0, sizeof(out));
+	XEN_TEST_CHECK(hex::decoded_len(hx_view) == sizeof(bytes));
+	XEN_TEST_CHECK(hex::decode(hx_view, out) == sizeof(bytes) && std::memcmp(out, bytes, sizeof(bytes)) == 0);
+
+	/// `str` and literals still convert
+	XEN_TEST_CHECK(hex::decode(hx, out) == sizeof(bytes) && base64::decode("AAEC", out) == 3 && out[2] == 2);
+	XEN_TEST_THROWS(hex::decode(str_slice{hx_framed}.sub(1, hx.len() + 2), out), err::IndexOutOfRange);
+	XEN_TEST_THROWS(hex::decode(str_slice{hx_framed}.sub(2, hx.len()), out), err::InvalidArgument);
+	return 0;
+}
@@ -0,0 +1,43 @@
+/// `err` metadata tables and `err_from_string`
+
+#include <cstring>
+#include <initializer_list>
+
+#include "err/err.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+static_assert(err_from_string("NumOverflow")->type == err::NumOverflow, "usable at compile time");
+static_assert(get_err_info(err::IoFailure).severity == err_severity::Warning);
+
+int main() {
+	const err ALL[] {err::Logic, err::IndexOutOfRange, err::InvalidArgument, err::NumOverflow,
+		err::NumUnderflow, err::DivideByZero, err::IoFailure};
+	XEN_TEST_CHECK(sizeof(ALL) / sizeof(ALL[0]) == _err::COUNT);
+
+	/// every name round-trips, through both overloads
+	for (const err type : ALL) {
+		const err_info& info = get_err_info(type);
+		XEN_TEST_CHECK(info.type == type && std::strlen(info.name) == info.name_len && info.desc != nullptr);
+		XEN_TEST_CHECK(std::strcmp(get_err_name(type), info.name) == 0);
+		XEN_TEST_CHECK(err_from_string(info.name) == &info && err_from_string(info.name, info.name_len) == &info);
+	}
+
+	XEN_TEST_CHECK(get_err_info(err::Logic).category == err_category::Logic);
+	XEN_TEST_CHECK(get_err_info(err::DivideByZero).category == err_category::Numeric);
+
+	/// names are matched exactly
+	XEN_TEST_CHECK(err_from_string("") == nullptr && err_from_string("", 0) == nullptr);
+	XEN_TEST_CHECK(err_from_string("Unknown") == nullptr && err_from_string("numoverflow") == nullptr);
+	XEN_TEST_CHECK(err_from_string("NumOverflowX") == nullptr && err_from_string("NumOverflo") == nullptr);
+	XEN_TEST_CHECK(err_from_string("NumOverflowX", 11) == &get_err_info(err::NumOverflow));
+
+	/// values outside the enumeration clamp to the `Unknown` entry
+	for (const u8_t raw : {u8_t(_err::COUNT), u8_t(0x7F), u8_t(0xFF)}) {
+		const err_info& info = get_err_info(static_cast<err>(raw));
+		XEN_TEST_CHECK(std::strcmp(info.name, "Unknown") == 0 && info.severity == err_severity::Fatal);
+	}
+
+	return 0;
+}
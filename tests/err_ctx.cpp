@@ -0,0 +1,70 @@
+/// `err_ctx` descriptions, captured arguments and `XEN_ERR_REPORT`
+
+#include <cstring>
+#include <sstream>
+
+#include "err/err_ctx.hpp"
+#include "err/err_limiter.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// @returns `true` if `ctx` renders to exactly `expect`
+static bool renders(const err_ctx& ctx, const char* expect) {
+	return std::strcmp(ctx.get_msg().c_str(), expect) == 0;
+}
+
+static u64_t reports = 0;
+
+int main() {
+	/// only constant arrays are kept by pointer, text in writable buffers is copied
+	const err_desc lit {"literal"};
+	XEN_TEST_CHECK(lit.is_static() && lit.len() == 7);
+
+	static constexpr char table[] = "table";
+	const err_desc from_table {table};
+	XEN_TEST_CHECK(from_table.is_static() && from_table.len() == 5);
+
+	/// a padded table keeps the length of its text, not of its array
+	static constexpr char padded[64] = "abc";
+	const err_desc from_padded {padded};
+	XEN_TEST_CHECK(from_padded.is_static() && from_padded.len() == 3 && std::strcmp(from_padded.c_str(), "abc") == 0);
+
+	char local[64] = "local";
+	static char shared[64] = "shared";
+	const err_desc from_local {local};
+	const err_desc from_shared {shared};
+	std::strcpy(local, "changed");
+	std::strcpy(shared, "changed");
+	XEN_TEST_CHECK(!from_local.is_static() && std::strcmp(from_local.c_str(), "local") == 0 && from_local.len() == 5);
+	XEN_TEST_CHECK(!from_shared.is_static() && std::strcmp(from_shared.c_str(), "shared") == 0 && from_shared.len() == 6);
+
+	const err_ctx from_buf {err::Logic, shared};
+	XEN_TEST_CHECK(!from_buf.DESC.is_static() && renders(from_buf, "changed"));
+
+	/// string literal arguments are captured as text
+	const u32_t io_line = __LINE__ + 1;
+	const err_ctx io {err::IoFailure, "open {} failed: {}", "cfg.txt", 5};
+	XEN_TEST_CHECK(io.ARGS.get_count() == 2 && renders(io, "open cfg.txt failed: 5"));
+
+	/// streamed with the err name and the call site
+	std::ostringstream os;
+	os << io;
+	const std::string expect = "[ERR]: IoFailure: open cfg.txt failed: 5 @ " + std::string{io.SITE.file_name()} + ':' + std::to_string(io_line) + '\n';
+	XEN_TEST_CHECK(io.SITE.line() == io_line && os.str() == expect);
+
+	const char* dyn = "dyn";
+	char buf[8] = "buf";
+	const str text {"text"};
+	const err_ctx mixed {err::InvalidArgument, "{} {} {} {}", dyn, buf, text, 'c'};
+	XEN_TEST_CHECK(renders(mixed, "dyn buf text c"));
+
+	/// literal arguments also go through the rate limited path
+	for (u64_t i = 0; i < 3; ++i) {
+		XEN_ERR_REPORT(1, 1, [](const err_ctx& ctx) { reports += renders(ctx, "no such file: a.txt"); },
+			err::IoFailure, "no such file: {}", "a.txt");
+	}
+
+	XEN_TEST_CHECK(reports == 1);
+	return 0;
+}
@@ -0,0 +1,128 @@
+/// `err_limiter` rate limits, samples & summarizes its sites, and `XEN_ERR_REPORT` evaluates its arguments once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "err/err_limiter.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// @returns The summary of the site labelled `fmt` from one `summarize`, `reported == suppressed == 0` if it had none
+static err_site_summary summary_of(const char* fmt, std::vector<u64_t>* sampled = nullptr) {
+	err_site_summary found {};
+	u64_t visits = 0;
+	err_limiter::summarize([&](const err_site_summary& sum) {
+		if (sum.fmt != fmt) return;
+		++visits;
+		found = sum;
+		if (sampled == nullptr) return;
+
+		for (const err_args& args : sum.samples) {
+			std::string text;
+			args.render("{}", [&text](const char* part, u64_t len) { text.append(part, len); });
+			sampled->push_back(std::stoull(text));
+		}
+	});
+
+	XEN_TEST_CHECK(visits <= 1);
+	found.samples = {};
+	return found;
+}
+
+static u64_t evaluated = 0;
+
+/// @returns Its call count, to tell how often an argument is evaluated
+static u64_t next_arg() { return evaluated++; }
+
+int main() {
+	/// `burst` back to back, the rest counted & sampled, the counters starting over after each summary
+	{
+		static constexpr char FMT[] = "burst {}";
+		static err_limiter lim {1, 2, err::Logic, FMT};
+
+		u64_t admitted = 0;
+		for (u64_t i = 0; i < 10; ++i) {
+			if (lim.admit()) ++admitted;
+			else lim.suppress(i);
+		}
+		XEN_TEST_CHECK(admitted == 2);
+
+		std::vector<u64_t> sampled;
+		const err_site_summary sum = summary_of(FMT, &sampled);
+		XEN_TEST_CHECK(sum.type == err::Logic && sum.line != 0 && sum.reported == 2 && sum.suppressed == 8);
+		XEN_TEST_CHECK(sampled.size() == err_limiter::SAMPLES);
+		for (u64_t val : sampled) XEN_TEST_CHECK(val >= 2 && val < 10);
+
+		/// the exchange reset the window, an idle site isn't summarized
+		const err_site_summary idle = summary_of(FMT);
+		XEN_TEST_CHECK(idle.reported == 0 && idle.suppressed == 0);
+
+		lim.suppress(u64_t{42});
+		sampled.clear();
+		XEN_TEST_CHECK(summary_of(FMT, &sampled).suppressed == 1 && sampled == std::vector<u64_t>{42});
+	}
+
+	/// the reservoir keeps a uniform sample: over many windows each value is kept about equally often
+	{
+		static constexpr char FMT[] = "sample {}";
+		static err_limiter lim {1, 1, err::Logic, FMT};
+		constexpr u64_t WINDOWS = 4000;
+		constexpr u64_t VALUES = 16;
+
+		u64_t kept[VALUES] {};
+		for (u64_t w = 0; w < WINDOWS; ++w) {
+			for (u64_t i = 0; i < VALUES; ++i) lim.suppress(i);
+
+			std::vector<u64_t> sampled;
+			(void)summary_of(FMT, &sampled);
+			for (u64_t val : sampled) ++kept[val];
+		}
+
+		/// each value is expected `WINDOWS * SAMPLES / VALUES` (1000) times
+		for (u64_t count : kept) XEN_TEST_CHECK(count > 700 && count < 1300);
+	}
+
+	/// a `burst` (or `per_sec`) of 0 mutes the site rather than acting as 1
+	{
+		static constexpr char FMT[] = "muted";
+		static err_limiter lim {10, 0, err::Logic, FMT};
+		for (u64_t i = 0; i < 5; ++i) {
+			if (!lim.admit()) lim.suppress();
+		}
+		const err_site_summary sum = summary_of(FMT);
+		XEN_TEST_CHECK(sum.reported == 0 && sum.suppressed == 5);
+	}
+
+	/// `XEN_ERR_REPORT` evaluates the arguments once per call, whether reported or suppressed
+	{
+		u64_t reports = 0;
+		for (u64_t i = 0; i < 4; ++i) {
+			XEN_ERR_REPORT(1, 1, [&reports](const err_ctx& ctx) { reports += ctx.ARGS.get_count(); },
+				err::IoFailure, "report {}", next_arg());
+		}
+		XEN_TEST_CHECK(reports == 1 && evaluated == 4);
+	}
+
+	/// `is_due` elects exactly one caller per period
+	{
+		constexpr u64_t PERIOD_NS = 150'000'000;
+		XEN_TEST_CHECK(err_limiter::is_due(0));
+		XEN_TEST_CHECK(!err_limiter::is_due(PERIOD_NS));
+		std::this_thread::sleep_for(std::chrono::nanoseconds{PERIOD_NS + 50'000'000});
+
+		std::atomic<u64_t> elected {0};
+		std::vector<std::thread> callers;
+		for (u64_t t = 0; t < 4; ++t) {
+			callers.emplace_back([&elected] {
+				for (u64_t i = 0; i < 1000; ++i) elected.fetch_add(err_limiter::is_due(PERIOD_NS), std::memory_order_relaxed);
+			});
+		}
+		for (std::thread& caller : callers) caller.join();
+		XEN_TEST_CHECK(elected.load() == 1);
+	}
+	return 0;
+}
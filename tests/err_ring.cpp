@@ -0,0 +1,106 @@
+/// `err_ring` hands records over oldest first in batches, and accounts for every record it drops
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "err/err_ring.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// one description per record, so a record's position in `TEXT` is its push order
+static constexpr u64_t RECORDS = 4000;
+static const char TEXT[RECORDS] {};
+
+/// @returns The push order of `rec`
+static u64_t order_of(const err_record& rec) { return static_cast<u64_t>(rec.desc - TEXT); }
+
+int main() {
+	/// one producer: batches of `BATCH`, oldest first
+	{
+		err_ring<256> ring;
+		for (u64_t i = 0; i < 200; ++i) ring.push(err::Logic, TEXT + i);
+
+		std::vector<u64_t> sizes;
+		u64_t next = 0;
+		bool ordered = true;
+		const u64_t drained = ring.drain([&](std::span<const err_record> batch) {
+			sizes.push_back(batch.size());
+			for (const err_record& rec : batch) ordered &= order_of(rec) == next++ && rec.type == err::Logic;
+		});
+
+		XEN_TEST_CHECK(drained == 200 && ordered && ring.get_lost() == 0);
+		XEN_TEST_CHECK(sizes == std::vector<u64_t>{64, 64, 64, 8});
+		XEN_TEST_CHECK(ring.drain([](std::span<const err_record>) {}) == 0);
+	}
+
+	/// once full the oldest records are overwritten and counted lost
+	{
+		err_ring<256> ring;
+		for (u64_t i = 0; i < 300; ++i) ring.push(err::IoFailure, TEXT + i);
+
+		u64_t next = 300 - 256;
+		bool ordered = true;
+		const u64_t drained = ring.drain([&](std::span<const err_record> batch) {
+			for (const err_record& rec : batch) ordered &= order_of(rec) == next++;
+		});
+		XEN_TEST_CHECK(drained == 256 && ordered && ring.get_lost() == 300 - 256 && ring.get_pushed() == 300);
+	}
+
+	/// `max` caps a drain, the next one resumes where it stopped
+	{
+		err_ring<64> ring;
+		for (u64_t i = 0; i < 10; ++i) ring.push(err::Logic, TEXT + i);
+
+		u64_t next = 0;
+		bool ordered = true;
+		const auto sink = [&](std::span<const err_record> batch) {
+			for (const err_record& rec : batch) ordered &= order_of(rec) == next++;
+		};
+		XEN_TEST_CHECK(ring.drain(sink, 4) == 4 && ring.drain(sink) == 6 && ordered);
+	}
+
+	/// several producers lapping a small ring while it drains: every record is drained or lost,
+	/// and each producer's records still arrive in the order it pushed them
+	{
+		constexpr u64_t PRODUCERS = 4;
+		constexpr u64_t EACH = RECORDS / PRODUCERS;
+
+		err_ring<16> ring;
+		std::atomic<u64_t> running {PRODUCERS};
+		std::vector<std::thread> producers;
+		for (u64_t p = 0; p < PRODUCERS; ++p) {
+			producers.emplace_back([&ring, &running, p] {
+				for (u64_t i = 0; i < EACH; ++i) {
+					ring.push(err::Logic, TEXT + p * EACH + i);
+					if (i % 64 == 0) std::this_thread::yield();
+				}
+				running.fetch_sub(1, std::memory_order_release);
+			});
+		}
+
+		/// the last order seen from each producer (by its block of `TEXT`), + 1
+		std::vector<u64_t> last(PRODUCERS, 0);
+		bool ordered = true;
+		u64_t drained = 0;
+		const auto sink = [&](std::span<const err_record> batch) {
+			ordered &= batch.size() <= err_ring<16>::BATCH;
+			for (const err_record& rec : batch) {
+				const u64_t order = order_of(rec);
+				u64_t& prev = last[order / EACH];
+				ordered &= order + 1 > prev;
+				prev = order + 1;
+			}
+		};
+
+		while (running.load(std::memory_order_acquire) != 0) drained += ring.drain(sink);
+		for (std::thread& producer : producers) producer.join();
+		drained += ring.drain(sink);
+
+		XEN_TEST_CHECK(ring.get_pushed() == RECORDS);
+		XEN_TEST_CHECK(drained + ring.get_lost() == ring.get_pushed());
+		XEN_TEST_CHECK(ordered);
+	}
+	return 0;
+}
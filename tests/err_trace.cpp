@@ -0,0 +1,51 @@
+/// `err_ctx` call sites and deferred stack traces (built with `XEN_ERR_CTX_TRACE` and frame pointers)
+
+#include <cstring>
+#include <sstream>
+
+#include "err/err_ctx.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+static u32_t ctx_line = 0;
+
+[[gnu::noinline]] static err_ctx make_ctx() {
+	ctx_line = __LINE__ + 1;
+	return err_ctx{err::IoFailure, "disk gone"};
+}
+
+[[gnu::noinline]] int outer_caller() {
+	const err_ctx ctx = make_ctx();
+	XEN_TEST_CHECK(ctx.SITE.line() == ctx_line && std::strstr(ctx.SITE.file_name(), "err_trace.cpp") != nullptr);
+
+	const err_trace& trace = ctx.TRACE;
+	XEN_TEST_CHECK(trace.get_depth() > 1 && trace.get_depth() <= err_trace::MAX_DEPTH);
+	XEN_TEST_CHECK(trace.get_frame(0) != nullptr && trace.get_frame(trace.get_depth()) == nullptr);
+
+	/// every frame visited in order, the callers found by name (exported through `-rdynamic`)
+	u64_t visited = 0;
+	bool found_outer = false;
+	trace.symbolize([&](u64_t i, const void* addr, const char* symbol, u64_t, const char*) {
+		XEN_TEST_CHECK(i == visited++ && addr == trace.get_frame(i));
+		found_outer |= symbol != nullptr && std::strstr(symbol, "outer_caller") != nullptr;
+	});
+
+	XEN_TEST_CHECK(visited == trace.get_depth() && found_outer);
+
+	std::ostringstream os;
+	os << trace;
+	XEN_TEST_CHECK(os.str().find("  #0 ") == 0 && os.str().find("outer_caller") != std::string::npos);
+
+	/// a printed `err_ctx` ends with its symbolized trace
+	std::ostringstream full;
+	full << ctx;
+	XEN_TEST_CHECK(full.str().find("[ERR]: IoFailure: disk gone @ ") == 0);
+	XEN_TEST_CHECK(full.str().find(os.str()) != std::string::npos);
+
+	/// `skip` leaves out the innermost frames
+	XEN_TEST_CHECK(err_trace::capture(1).get_frame(0) == err_trace::capture().get_frame(1));
+	return 0;
+}
+
+int main() { return outer_caller(); }
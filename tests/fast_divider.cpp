@@ -0,0 +1,23 @@
+/// `fast_divider` matches hardware division and is never built implicitly from a divisor
+
+#include "core/fast_divider.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+static_assert(!std::is_convertible_v<u64_t, fast_divider> && !std::is_convertible_v<safe_u64, fast_divider>);
+static_assert(std::is_constructible_v<fast_divider, u64_t> && std::is_constructible_v<fast_divider, safe_u64>);
+
+int main() {
+	constexpr u64_t DIVISORS[] {1, 2, 3, 7, 10, 641, 1'000'000'007, U64_MAX / 3, U64_MAX - 1, U64_MAX};
+	constexpr u64_t NUMS[] {0, 1, 6, 99, 1'000'000, U64_MAX / 2, U64_MAX - 1, U64_MAX};
+
+	for (const u64_t div : DIVISORS) {
+		const fast_divider fast {div};
+		for (const u64_t num : NUMS) XEN_TEST_CHECK(num / fast == num / div && num % fast == num % div);
+	}
+
+	XEN_TEST_CHECK(safe_u64{100} / fast_divider{safe_u64{7}} == 14u);
+	XEN_TEST_THROWS(fast_divider{0}, err::DivideByZero);
+	return 0;
+}
@@ -0,0 +1,52 @@
+/// `int_telemetry` keeps the counters of exited threads and reuses their tables
+
+#include <thread>
+
+#include "core/safe_u64.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// @returns `{calls, fails}` summed over every thread at the site on `line`
+static int_site_stats at_line(u32_t line) {
+	int_site_stats total {};
+	int_telemetry::visit([&](const int_site_stats& site) {
+		if (site.line != line) return;
+		total.calls += site.calls;
+		total.fails += site.fails;
+	});
+
+	return total;
+}
+
+static u32_t site_line = 0;
+
+static void work(u64_t times) {
+	safe_u64 val {0};
+	for (u64_t i = 0; i < times; ++i) { val += i; site_line = __LINE__; }
+}
+
+int main() {
+	for (u64_t round = 0; round < 4; ++round) std::thread{work, 10}.join();
+	work(5);
+
+	const u32_t LINE = site_line;
+
+	const int_site_stats total = at_line(LINE);
+	XEN_TEST_CHECK(total.calls == 45 && total.fails == 0);
+
+	/// every exited thread merged into one entry, their tables reused instead of leaked
+	u64_t entries = 0, exited = 0;
+	int_telemetry::visit([&](const int_site_stats& site) {
+		if (site.line != LINE) return;
+		++entries;
+		exited += site.thread == int_telemetry::EXITED ? site.calls : 0;
+	});
+
+	XEN_TEST_CHECK(entries == 2 && exited == 40 && int_telemetry::get_table_count() == 1);
+
+	int_site_stats sites[4];
+	XEN_TEST_CHECK(int_telemetry::snapshot(sites) == 2 && sites[1].thread == int_telemetry::EXITED);
+	XEN_TEST_CHECK(int_telemetry::get_dropped() == 0);
+	return 0;
+}
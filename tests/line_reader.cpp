@@ -0,0 +1,88 @@
+/// `line_reader` yields the same lines from text, a mapped file or a descriptor, whatever its buffer size
+
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "io/line_reader.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// @returns Path of a new temporary file holding `text`
+static std::string temp_file(const std::string& text) {
+	char path[] = "/tmp/xen_line_reader_XXXXXX";
+	const int fd = ::mkstemp(path);
+	XEN_TEST_CHECK(fd >= 0);
+	XEN_TEST_CHECK(::write(fd, text.data(), text.size()) == static_cast<::ssize_t>(text.size()));
+	::close(fd);
+	return path;
+}
+
+/// @returns Every line `reader` yields
+static std::vector<std::string> lines_of(line_reader& reader) {
+	std::vector<std::string> lines;
+	str_slice line;
+	while (reader.next(line)) lines.emplace_back(line.data(), line.len());
+	return lines;
+}
+
+/// @details Checks `text` splits into `expect` from a slice, a mapped file and a descriptor read through tiny to large buffers
+static void check(const std::string& text, const std::vector<std::string>& expect) {
+	line_reader from_text {str_slice{text.data(), text.size()}};
+	XEN_TEST_CHECK(lines_of(from_text) == expect);
+
+	const std::string path = temp_file(text);
+	const mapped_file file {path.c_str()};
+	line_reader from_map {file};
+	XEN_TEST_CHECK(lines_of(from_map) == expect);
+
+	/// buffers smaller than, equal to and larger than the lines, so lines straddle refills & grow the buffer
+	for (u64_t buf_size : {u64_t{0}, u64_t{1}, u64_t{2}, u64_t{3}, u64_t{7}, u64_t{63}, u64_t{64}, u64_t{65}, u64_t{100}, u64_t{4096}}) {
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		XEN_TEST_CHECK(fd >= 0);
+		line_reader from_fd {fd, buf_size};
+		XEN_TEST_CHECK(lines_of(from_fd) == expect);
+		::close(fd);
+	}
+
+	::unlink(path.c_str());
+}
+
+int main() {
+	check("", {});
+	check("\n", {""});
+	check("one", {"one"});
+	check("one\ntwo\n", {"one", "two"});
+	check("one\ntwo", {"one", "two"});
+	check("\n\na\n\n", {"", "", "a", ""});
+
+	/// CRLF input keeps its `\r`
+	check("dos\r\nline\r\n", {"dos\r", "line\r"});
+	check("mixed\r\nunix\nlast\r", {"mixed\r", "unix", "last\r"});
+
+	/// lines around the 64 byte vector steps, a newline at every position of a block
+	const std::string wide(64, 'w');
+	check(wide + "\n" + wide + wide + "x", {wide, wide + wide + "x"});
+	std::string text;
+	std::vector<std::string> expect;
+	for (u64_t len = 0; len < 200; ++len) {
+		expect.emplace_back(len, static_cast<char>('a' + len % 26));
+		text += expect.back() + "\n";
+	}
+	check(text, expect);
+
+	/// a moved reader carries on where the source stopped
+	const std::string moved_text = "a\nb\nc";
+	line_reader first {str_slice{moved_text.data(), moved_text.size()}};
+	str_slice line;
+	XEN_TEST_CHECK(first.next(line) && line == str_slice{"a"});
+	line_reader second {std::move(first)};
+	XEN_TEST_CHECK(!first.next(line) && lines_of(second) == std::vector<std::string>{"b", "c"});
+
+	/// a descriptor which can't be read
+	line_reader broken {-1, 16};
+	XEN_TEST_THROWS(broken.next(line), err::IoFailure);
+	return 0;
+}
@@ -0,0 +1,59 @@
+/// `mapped_file` maps whole files, empty ones included, and reports what it can't map as `err::IoFailure`
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "io/mapped_file.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// @returns Path of a new temporary file holding `text`
+static std::string temp_file(const std::string& text) {
+	char path[] = "/tmp/xen_mapped_file_XXXXXX";
+	const int fd = ::mkstemp(path);
+	XEN_TEST_CHECK(fd >= 0);
+	XEN_TEST_CHECK(::write(fd, text.data(), text.size()) == static_cast<::ssize_t>(text.size()));
+	::close(fd);
+	return path;
+}
+
+int main() {
+	/// contents are viewed in place
+	const std::string text = std::string(5000, 'x') + "tail";
+	const std::string path = temp_file(text);
+	mapped_file file {path.c_str(), map_access::Random};
+	XEN_TEST_CHECK(!file.is_empty() && file.len() == text.size());
+	XEN_TEST_CHECK(std::memcmp(file.data(), text.data(), text.size()) == 0 && file.as_slice().sub(5000, 4) == str_slice{"tail"});
+
+	/// range hints are bounds checked, page alignment is the mapping's job
+	file.advise(map_access::WillNeed, 4097, 7);
+	file.advise(map_access::Sequential, text.size(), 0);
+	XEN_TEST_THROWS(file.advise(map_access::Normal, text.size() + 1, 0), err::IndexOutOfRange);
+	XEN_TEST_THROWS(file.advise(map_access::Normal, 10, text.size()), err::IndexOutOfRange);
+
+	/// moves hand the mapping over, the source is left empty
+	mapped_file moved {std::move(file)};
+	XEN_TEST_CHECK(file.is_empty() && file.data() == nullptr && moved.len() == text.size());
+	file = std::move(moved);
+	XEN_TEST_CHECK(moved.is_empty() && file.as_slice().len() == text.size());
+	file.reset();
+	XEN_TEST_CHECK(file.is_empty() && file.data() == nullptr);
+	::unlink(path.c_str());
+
+	/// an empty file maps to an empty slice
+	const std::string empty_path = temp_file("");
+	const mapped_file empty {empty_path.c_str()};
+	XEN_TEST_CHECK(empty.is_empty() && empty.data() == nullptr && empty.as_slice().is_empty());
+	empty.advise(map_access::WillNeed);
+	::unlink(empty_path.c_str());
+
+	/// a missing file can't be opened, a directory opens but can't be mapped (if its size isn't 0, which maps nothing)
+	XEN_TEST_THROWS(mapped_file{"/nonexistent/xen_mapped_file"}, err::IoFailure);
+	struct stat root {};
+	if (::stat("/", &root) == 0 && root.st_size > 0) XEN_TEST_THROWS(mapped_file{"/"}, err::IoFailure);
+	return 0;
+}
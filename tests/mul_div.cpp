@@ -0,0 +1,28 @@
+/// `mul_div` / `mul_add` keep the product in 128 bits, take a raw or a `safe_int` first operand
+
+#include "core/mul_div.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+typedef safe_int<u64_t, overflow::saturate> sat_u64;
+
+static_assert(std::is_same_v<decltype(mul_div(u64_t{1}, 2, 3)), safe_u64> && std::is_same_v<decltype(mul_div(sat_u64{1}, 2, 3)), sat_u64>);
+static_assert(std::is_same_v<decltype(mul_add(u64_t{1}, 2, 3)), safe_u64> && std::is_same_v<decltype(mul_add(sat_u64{1}, 2, 3)), sat_u64>);
+static_assert(mul_div(u64_t{10}, 3, 4) == 7u && mul_add(u64_t{10}, 3, 4) == 34u);
+
+int main() {
+	/// a rate: the intermediate product is past `u64_t`, the result isn't
+	const u64_t bytes = u64_t{1} << 40;
+	XEN_TEST_CHECK(mul_div(bytes, 1'000'000'000, 1'000'000) == bytes * 1000);
+	XEN_TEST_CHECK(mul_div(U64_MAX, U64_MAX, U64_MAX) == U64_MAX && mul_div(safe_u64{U64_MAX}, 3, 4) == U64_MAX / 4 * 3 + 2);
+	XEN_TEST_CHECK(mul_add(U64_MAX / 2, 2, 1) == U64_MAX && mul_add(safe_u64{0}, U64_MAX, U64_MAX) == U64_MAX);
+
+	/// failures follow the policy of `a`, a raw `a` fails like `safe_u64`
+	XEN_TEST_THROWS(mul_div(U64_MAX, 2, 1), err::NumOverflow);
+	XEN_TEST_THROWS(mul_div(u64_t{1}, 1, 0), err::DivideByZero);
+	XEN_TEST_THROWS(mul_add(U64_MAX, 1, 1), err::NumOverflow);
+	XEN_TEST_THROWS(mul_div(safe_u64{U64_MAX}, 2, 1), err::NumOverflow);
+	XEN_TEST_CHECK(mul_div(sat_u64{U64_MAX}, 2, 1) == U64_MAX && mul_add(sat_u64{U64_MAX}, 2, 1) == U64_MAX);
+	return 0;
+}
@@ -0,0 +1,82 @@
+/// `result` layout & chaining, and `parse_int`
+
+#include <cstring>
+
+#include "err/result.hpp"
+#include "str/parse.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// an enum which does use `0xFF`, so it must not share the tag byte
+enum class my_err : u8_t { Low = 0, Bad = 0xFF };
+
+/// an enum opted in to the compact layout
+enum class small_err : u8_t { A, B };
+template <> inline constexpr bool xen::is_result_niche_v<small_err> = true;
+
+static_assert(sizeof(result<u32_t>) == 8 && sizeof(result<u8_t>) == 2);
+static_assert(sizeof(result<u8_t, small_err>) == 2);
+static_assert(sizeof(result<u8_t, my_err>) == 3);
+
+static result<u64_t> half(u64_t val) {
+	if (val % 2 != 0) return err::InvalidArgument;
+	return val / 2;
+}
+
+static result<u64_t> quarter(u64_t val) {
+	XEN_TRY(once, half(val));
+	XEN_TRY(twice, half(once));
+	return twice;
+}
+
+int main() {
+	/// every error value is an error, `0xFF` included
+	const result<int, my_err> bad {my_err::Bad};
+	XEN_TEST_CHECK(bad.is_err() && bad.get_err() == my_err::Bad);
+	XEN_TEST_CHECK(result<int, my_err>{my_err::Low}.is_err() && result<int, my_err>{7}.is_ok());
+	XEN_TEST_CHECK(result<int, small_err>{small_err::B}.get_err() == small_err::B);
+
+	const result<u64_t> ok {8};
+	const result<u64_t> fail {err::NumOverflow};
+	XEN_TEST_CHECK(ok && !fail && ok.get_val() == 8 && fail.get_err() == err::NumOverflow);
+	XEN_TEST_CHECK(ok.get_or(1) == 8 && fail.get_or(1) == 1);
+	XEN_TEST_CHECK(ok.unwrap() == 8);
+	XEN_TEST_THROWS(fail.unwrap(), err::NumOverflow);
+
+	/// chaining
+	XEN_TEST_CHECK(ok.map([](u64_t v) { return v + 1; }).get_val() == 9);
+	XEN_TEST_CHECK(fail.map([](u64_t v) { return v + 1; }).get_err() == err::NumOverflow);
+	XEN_TEST_CHECK(ok.and_then(half).and_then(half).get_val() == 2);
+	XEN_TEST_CHECK(result<u64_t>{6}.and_then(half).and_then(half).get_err() == err::InvalidArgument);
+	XEN_TEST_CHECK(fail.or_else([](err) { return result<u64_t>{0}; }).get_val() == 0);
+	XEN_TEST_CHECK(ok.or_else([](err) { return result<u64_t>{0}; }).get_val() == 8);
+
+	/// `XEN_TRY` propagates the first error
+	XEN_TEST_CHECK(quarter(12).get_val() == 3 && quarter(6).get_err() == err::InvalidArgument);
+
+	/// `parse_int`: bases & sign
+	XEN_TEST_CHECK(parse_int<u64_t>("18446744073709551615").get_val() == U64_MAX);
+	XEN_TEST_CHECK(parse_int<i64_t>("-9223372036854775808").get_val() == std::numeric_limits<i64_t>::min());
+	XEN_TEST_CHECK(parse_int<i32_t>("+42").get_val() == 42 && parse_int<i32_t>("-42").get_val() == -42);
+	XEN_TEST_CHECK(parse_int<u32_t>("ff", 16).get_val() == 255 && parse_int<u32_t>("FF", 16).get_val() == 255);
+	XEN_TEST_CHECK(parse_int<u8_t>("101", 2).get_val() == 5 && parse_int<u64_t>("zz", 36).get_val() == 36 * 36 - 1);
+	XEN_TEST_CHECK(parse_int<safe_u64>("7").get_val() == 7u);
+
+	/// `parse_int`: range
+	XEN_TEST_CHECK(parse_int<u64_t>("18446744073709551616").get_err() == err::NumOverflow);
+	XEN_TEST_CHECK(parse_int<i64_t>("-9223372036854775809").get_err() == err::NumUnderflow);
+	XEN_TEST_CHECK(parse_int<i8_t>("128").get_err() == err::NumOverflow && parse_int<i8_t>("-128").get_val() == -128);
+	XEN_TEST_CHECK(parse_int<u8_t>("256").get_err() == err::NumOverflow);
+
+	/// `parse_int`: invalid input, a bad character outranks the range error
+	XEN_TEST_CHECK(parse_int<u64_t>("").get_err() == err::InvalidArgument);
+	XEN_TEST_CHECK(parse_int<i64_t>("-").get_err() == err::InvalidArgument);
+	XEN_TEST_CHECK(parse_int<u64_t>("-1").get_err() == err::InvalidArgument);
+	XEN_TEST_CHECK(parse_int<u64_t>("12a").get_err() == err::InvalidArgument);
+	XEN_TEST_CHECK(parse_int<u64_t>(" 1").get_err() == err::InvalidArgument);
+	XEN_TEST_CHECK(parse_int<u8_t>("999x").get_err() == err::InvalidArgument);
+	XEN_TEST_CHECK(parse_int<u64_t>("2", 2).get_err() == err::InvalidArgument);
+	XEN_TEST_CHECK(parse_int<u64_t>("1", 1).get_err() == err::InvalidArgument && parse_int<u64_t>("1", 37).get_err() == err::InvalidArgument);
+	return 0;
+}
@@ -0,0 +1,77 @@
+/// `safe_int` overflow policies, mixed-sign operands and narrowing construction
+
+#include <limits>
+
+#include "core/safe_int.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+typedef safe_int<u8_t, overflow::saturate> sat_u8;
+typedef safe_int<i8_t, overflow::saturate> sat_i8;
+typedef safe_int<u8_t, overflow::wrap> wrap_u8;
+typedef safe_int<i32_t, overflow::wrap> wrap_i32;
+typedef safe_int<u16_t, overflow::err_code> code_u16;
+
+static_assert(sizeof(safe_i8) == 1 && sizeof(safe_u16) == 2 && sizeof(safe_i32) == 4 && sizeof(safe_u64) == 8);
+static_assert(!noexcept(safe_u8{} + 1) && noexcept(sat_u8{} + 1) && noexcept(wrap_u8{} + 1) && noexcept(code_u16{} + 1));
+static_assert(noexcept(safe_int<u8_t, overflow::debug_assert>{} + 1));
+
+/// failures are resolved at compile time too
+static_assert(sat_u8{250} + 10 == 255 && wrap_u8{250} + 10 == 4 && sat_i8{-100} - 100 == -128);
+
+int main() {
+	/// throw_err: the value is left as it was
+	safe_u8 thrown {200};
+	XEN_TEST_THROWS(thrown += 100, err::NumOverflow);
+	XEN_TEST_THROWS(thrown -= 201, err::NumUnderflow);
+	XEN_TEST_THROWS(thrown *= 2, err::NumOverflow);
+	XEN_TEST_THROWS(thrown /= 0, err::DivideByZero);
+	XEN_TEST_CHECK(thrown == 200);
+	XEN_TEST_THROWS(safe_i8{-128} / -1, err::NumOverflow);
+
+	/// saturate: clamps to the bound the result went past
+	XEN_TEST_CHECK(sat_u8{200} * 2 == 255 && sat_u8{5} - 6 == 0 && sat_u8{3} - 300 == 0);
+	XEN_TEST_CHECK(sat_i8{100} * -2 == -128 && sat_i8{100} * 2 == 127 && sat_i8{-128} / -1 == 127);
+
+	/// wrap: the raw integer's result
+	wrap_u8 wrapped {255};
+	++wrapped;
+	XEN_TEST_CHECK(wrapped == 0 && wrap_u8{0} - 1 == 255 && wrap_i32{std::numeric_limits<i32_t>::max()} + 1 == std::numeric_limits<i32_t>::min());
+
+	/// err_code: keeps the value, records the failure per thread
+	overflow::err_code::clear();
+	code_u16 coded {65535};
+	coded += 1;
+	XEN_TEST_CHECK(coded == 65535 && overflow::err_code::has_err() && overflow::err_code::last_err() == err::NumOverflow);
+	overflow::err_code::clear();
+	coded /= 0;
+	XEN_TEST_CHECK(coded == 65535 && overflow::err_code::last_err() == err::DivideByZero);
+	overflow::err_code::clear();
+	coded -= 65535;
+	XEN_TEST_CHECK(coded == 0 && !overflow::err_code::has_err());
+
+	/// mixed signs follow the real math: `0 * -1` is 0, not an underflow
+	XEN_TEST_CHECK(safe_u64{0} * -1 == 0u && safe_u64{5} * i64_t{0} == 0u);
+	XEN_TEST_THROWS(safe_u64{1} * -1, err::NumUnderflow);
+	XEN_TEST_CHECK(safe_u64{10} + -3 == 7u && safe_u64{10} - -3 == 13u);
+	XEN_TEST_THROWS(safe_u64{2} + -3, err::NumUnderflow);
+
+	/// a negative divisor underflows an unsigned result (was `err::DivideByZero`), unless the quotient is 0
+	XEN_TEST_THROWS(safe_u64{10} / -2, err::NumUnderflow);
+	XEN_TEST_CHECK(safe_u64{0} / -2 == 0u && safe_u64{1} / -2 == 0u);
+	XEN_TEST_THROWS(safe_u64{10} / 0, err::DivideByZero);
+	XEN_TEST_CHECK(safe_i64{-9} / 2 == -4 && safe_i64{9} / u64_t{3} == 3);
+
+	/// raw integer on the left
+	XEN_TEST_CHECK(100 - safe_u8{1} == 99 && 7 / safe_u8{2} == 3 && 3 * safe_u8{5} == 15);
+	XEN_TEST_THROWS(1 - safe_u8{2}, err::NumUnderflow);
+	XEN_TEST_THROWS(300 - safe_u8{1}, err::NumOverflow);
+
+	/// comparisons hold across signedness
+	XEN_TEST_CHECK(safe_u64{0} > -1 && safe_i8{-1} < u64_t{1} && safe_u8{255} == safe_i64{255});
+
+	/// narrowing construction clamps into range
+	XEN_TEST_CHECK(safe_u8{300} == 255 && safe_u8{-5} == 0 && safe_i8{-1000} == -128 && safe_i8{U64_MAX} == 127);
+	return 0;
+}
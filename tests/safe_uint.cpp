@@ -0,0 +1,83 @@
+/// `safe_u128` / `safe_u256` arithmetic across limbs, checked against `unsigned __int128` where it fits
+
+#include "core/safe_uint.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+static_assert(sizeof(safe_u128) == 16 && sizeof(safe_u256) == 32);
+static_assert(safe_u128{U64_MAX} + 1 == safe_u128::from_limbs({0, 1}), "usable at compile time");
+
+/// @returns `val` as a `safe_u128`
+[[nodiscard]] static safe_u128 wide(unsigned __int128 val) {
+	return safe_u128::from_limbs({static_cast<u64_t>(val), static_cast<u64_t>(val >> 64)});
+}
+
+[[nodiscard]] static u64_t next(u64_t& state) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+int main() {
+	/// carry & borrow run through every limb
+	const safe_u256 low_max = safe_u256::from_limbs({U64_MAX, U64_MAX, U64_MAX, 0});
+	XEN_TEST_CHECK(low_max + 1 == safe_u256::from_limbs({0, 0, 0, 1}));
+	XEN_TEST_CHECK(safe_u256::from_limbs({0, 0, 0, 1}) - 1 == low_max);
+	XEN_TEST_THROWS(safe_u256::max() + 1, err::NumOverflow);
+	XEN_TEST_THROWS(safe_u256{0} - 1, err::NumUnderflow);
+	XEN_TEST_THROWS(safe_u128::from_limbs({0, 1}) - safe_u128::from_limbs({1, 1}), err::NumUnderflow);
+
+	safe_u128 counter {U64_MAX};
+	XEN_TEST_CHECK(++counter == safe_u128::from_limbs({0, 1}) && counter-- == safe_u128::from_limbs({0, 1}) && counter == U64_MAX);
+
+	/// multiplication overflow right at the limb boundary
+	const safe_u128 two_64 = safe_u128::from_limbs({0, 1});
+	XEN_TEST_CHECK(safe_u128{U64_MAX} * safe_u128{U64_MAX} == safe_u128::from_limbs({1, U64_MAX - 1}));
+	XEN_TEST_CHECK(two_64 * (U64_MAX) == safe_u128::from_limbs({0, U64_MAX}));
+	XEN_TEST_THROWS(two_64 * two_64, err::NumOverflow);
+	XEN_TEST_THROWS(safe_u128::from_limbs({0, U64_MAX}) * 2, err::NumOverflow);
+	XEN_TEST_THROWS(safe_u128::max() * safe_u128{2}, err::NumOverflow);
+	XEN_TEST_CHECK(safe_u256::from_limbs({0, 0, 1, 0}) * safe_u256::from_limbs({0, 1, 0, 0}) == safe_u256::from_limbs({0, 0, 0, 1}));
+	XEN_TEST_THROWS(safe_u256::from_limbs({0, 0, 1, 0}) * safe_u256::from_limbs({0, 0, 1, 0}), err::NumOverflow);
+
+	/// division, single & multi limb divisors
+	XEN_TEST_THROWS(safe_u128{5} / safe_u128{0}, err::DivideByZero);
+	XEN_TEST_THROWS(safe_u256::max() % safe_u256{}, err::DivideByZero);
+	XEN_TEST_CHECK(safe_u256::max() / safe_u256::max() == 1 && safe_u256::max() % safe_u256::max() == 0);
+	XEN_TEST_CHECK(safe_u256::from_limbs({7, 0, 0, 1}) % safe_u256::from_limbs({0, 0, 0, 1}) == 7);
+
+	/// narrowing construction throws only when lossy
+	XEN_TEST_CHECK(safe_u128{safe_u256::from_limbs({1, 2, 0, 0})} == safe_u128::from_limbs({1, 2}));
+	XEN_TEST_THROWS(safe_u128{safe_u256::from_limbs({1, 2, 3, 0})}, err::NumOverflow);
+	XEN_TEST_THROWS(safe_u128{safe_u256::from_limbs({0, 0, 0, 1})}, err::NumOverflow);
+	XEN_TEST_CHECK(safe_u128{42}.to_u64() == 42u && safe_u64{safe_u128{U64_MAX}} == U64_MAX);
+	XEN_TEST_THROWS(two_64.to_u64(), err::NumOverflow);
+	XEN_TEST_CHECK(safe_u128{-5} == 0 && safe_u256{safe_u128::max()} == safe_u256::from_limbs({U64_MAX, U64_MAX, 0, 0}));
+	XEN_TEST_THROWS(two_64.get_limb(2), err::IndexOutOfRange);
+
+	/// every operator against `unsigned __int128`, on operands of mixed widths
+	u64_t state = 0x2545F4914F6CDD1Dull;
+	for (u64_t round = 0; round < 20000; ++round) {
+		const u64_t shape = next(state);
+		const unsigned __int128 a = (static_cast<unsigned __int128>(shape & 1 ? next(state) : 0) << 64) | next(state);
+		const unsigned __int128 b = (static_cast<unsigned __int128>(shape & 2 ? next(state) >> (shape % 64) : 0) << 64)
+			| (next(state) >> ((shape >> 8) % 64));
+
+		const bool add_fits = a + b >= a;
+		if (add_fits) XEN_TEST_CHECK(wide(a) + wide(b) == wide(a + b));
+		else XEN_TEST_THROWS(wide(a) + wide(b), err::NumOverflow);
+
+		if (a >= b) XEN_TEST_CHECK(wide(a) - wide(b) == wide(a - b));
+		else XEN_TEST_THROWS(wide(a) - wide(b), err::NumUnderflow);
+
+		const bool mul_fits = b == 0 || a <= ~static_cast<unsigned __int128>(0) / b;
+		if (mul_fits) XEN_TEST_CHECK(wide(a) * wide(b) == wide(a * b));
+		else XEN_TEST_THROWS(wide(a) * wide(b), err::NumOverflow);
+
+		if (b != 0) XEN_TEST_CHECK(wide(a) / wide(b) == wide(a / b) && wide(a) % wide(b) == wide(a % b));
+	}
+
+	return 0;
+}
@@ -0,0 +1,39 @@
+/// `sharded_counter` counts exactly across threads, and reports overflow at every `XEN_CHECK_LEVEL`,
+/// also when only combining two shards overflows
+
+#include <thread>
+#include <vector>
+
+#include "core/sharded_counter.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+int main() {
+	/// more threads than shards share them, every joined `add` is counted
+	sharded_counter<4> hits;
+	std::vector<std::thread> workers;
+	for (u64_t t = 0; t < 8; ++t) {
+		workers.emplace_back([&hits, t] {
+			for (u64_t i = 0; i < 10'000; ++i) ++hits;
+			hits += t;
+		});
+	}
+	for (std::thread& worker : workers) worker.join();
+	XEN_TEST_CHECK(hits.read_exact() == 80'000u + 28u && hits.read_approx() == 80'028u);
+
+	hits.reset();
+	XEN_TEST_CHECK(hits.read_exact() == 0u && hits.get_shard_count() == 4);
+
+	/// a full shard throws and is left as it was
+	sharded_counter<2> counter;
+	counter.add(U64_MAX);
+	XEN_TEST_THROWS(counter.add(1), err::NumOverflow);
+	XEN_TEST_CHECK(counter.read_exact() == U64_MAX);
+
+	/// each shard fits, only their sum doesn't
+	std::thread{[&counter] { counter.add(1); }}.join();
+	XEN_TEST_CHECK(counter.read_approx() == U64_MAX);
+	XEN_TEST_THROWS(counter.read_exact(), err::NumOverflow);
+	return 0;
+}
@@ -0,0 +1,71 @@
+/// `str_pool` recycles buffers per size class up to its cap, passes large ones through,
+/// and takes buffers freed on another thread than the one which acquired them
+
+#include <thread>
+
+#include "str/str.hpp"
+#include "str/str_pool.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// @details Runs `fn` on a new thread, so it starts with empty free lists & zeroed counters
+template <typename F_>
+static void on_thread(F_ fn) { std::thread{fn}.join(); }
+
+int main() {
+	/// a released buffer is handed back by the next acquire of its size class
+	on_thread([] {
+		char* first = str_pool::acquire(20);
+		str_pool::release(first, 20);
+		char* again = str_pool::acquire(32);
+		const str_pool_stats stats = str_pool::get_stats();
+		XEN_TEST_CHECK(again == first && stats.misses == 1 && stats.hits == 1 && stats.recycled == 1 && stats.cached == 0);
+
+		/// other size classes don't share it
+		char* other = str_pool::acquire(33);
+		XEN_TEST_CHECK(other != again && str_pool::get_stats().misses == 2);
+		str_pool::release(again, 32);
+		str_pool::release(other, 33);
+		XEN_TEST_CHECK(str_pool::get_stats().cached == 2);
+
+		str_pool::trim();
+		XEN_TEST_CHECK(str_pool::get_stats().cached == 0);
+	});
+
+	/// past the cap releases are freed, not cached
+	str_pool::set_cap(2);
+	on_thread([] {
+		char* bufs[3] {str_pool::acquire(100), str_pool::acquire(100), str_pool::acquire(100)};
+		for (char* buf : bufs) str_pool::release(buf, 100);
+
+		const str_pool_stats stats = str_pool::get_stats();
+		XEN_TEST_CHECK(str_pool::get_cap() == 2 && stats.recycled == 2 && stats.dropped == 1 && stats.cached == 2);
+	});
+	str_pool::set_cap(64);
+
+	/// buffers over the largest size class bypass the pool entirely
+	on_thread([] {
+		char* big = str_pool::acquire(4096);
+		str_pool::release(big, 4096);
+		const str_pool_stats stats = str_pool::get_stats();
+		XEN_TEST_CHECK(stats.hits == 0 && stats.misses == 0 && stats.recycled == 0 && stats.cached == 0);
+	});
+
+	/// a buffer acquired on one thread & released on another lands on the releasing thread's free list
+	char* moved = nullptr;
+	on_thread([&moved] { moved = str_pool::acquire(64); });
+	on_thread([&moved] {
+		str_pool::release(moved, 64);
+		XEN_TEST_CHECK(str_pool::get_stats().recycled == 1 && str_pool::acquire(64) == moved);
+		str_pool::release(moved, 64);
+	});
+
+	/// `str` goes through the pool, a freed string's buffer serves the next one
+	on_thread([] {
+		{ const str first {"a string long enough"}; }
+		const str second {"another, as long text"};
+		XEN_TEST_CHECK(str_pool::get_stats().hits == 1 && second == "another, as long text");
+	});
+	return 0;
+}
@@ -0,0 +1,53 @@
+/// `str_slice` views & bounds, `join` and `str::concat`
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "str/str_slice.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+/// @returns `true` if `text` holds exactly `expect` (an empty `str` has no buffer)
+static bool holds(const str& text, const char* expect) {
+	return text.len() == std::strlen(expect) && (text.len() == 0u || std::strcmp(text.c_str(), expect) == 0);
+}
+
+int main() {
+	/// views, no copies
+	const str owner {"hello world"};
+	const str_slice all {owner};
+	XEN_TEST_CHECK(all.data() == owner.c_str() && all.len() == 11u && all[4] == 'o');
+	XEN_TEST_CHECK(str_slice{static_cast<const char*>(nullptr)}.is_empty() && str_slice{""}.is_empty());
+
+	const str_slice word = all.sub(6, 5);
+	XEN_TEST_CHECK(word == str_slice{"world"} && word != str_slice{"World"} && word != str_slice{"worl"});
+	XEN_TEST_CHECK(all.sub(11, 0).is_empty() && holds(word.to_str(), "world") && holds(str_slice{}.to_str(), ""));
+
+	/// bounds
+	XEN_TEST_THROWS(all.sub(12, 0), err::IndexOutOfRange);
+	XEN_TEST_THROWS(all.sub(6, 6), err::IndexOutOfRange);
+	XEN_TEST_THROWS(all[11], err::IndexOutOfRange);
+
+	/// `join` over any range of slice-able parts
+	const std::vector<const char*> words {"a", "bc", "", "def"};
+	XEN_TEST_CHECK(holds(join(words, ", "), "a, bc, , def"));
+	XEN_TEST_CHECK(holds(join(words), "abcdef"));
+
+	const std::array<str, 3> strs {str{"x"}, str{"y"}, str{"z"}};
+	XEN_TEST_CHECK(holds(join(strs, str_slice{"--"}), "x--y--z"));
+
+	const std::vector<str_slice> slices {all.sub(0, 5), word};
+	XEN_TEST_CHECK(holds(join(slices, " "), "hello world"));
+
+	XEN_TEST_CHECK(holds(join(std::vector<const char*>{}, ", "), "") && holds(join(std::vector<const char*>{"one"}, ", "), "one"));
+	XEN_TEST_CHECK(holds(join(std::vector<const char*>{"", ""}, "|"), "|"));
+
+	/// `concat` & `+` copy both sides in bulk
+	XEN_TEST_CHECK(holds(str::concat(str{"ab"}, str{"cd"}), "abcd") && holds(str{""} + str{"x"}, "x"));
+	str grown {"a"};
+	grown += str{"bc"};
+	XEN_TEST_CHECK(holds(grown, "abc"));
+	return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#ifndef XEN_TEST
+#define XEN_TEST
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "err/err.hpp"
+
+/// @details Fails the test (exit code 1) unless the condition holds (variadic, so template commas need no parentheses)
+#define XEN_TEST_CHECK(...) \
+	do { \
+		if (!(__VA_ARGS__)) { \
+			std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #__VA_ARGS__); \
+			std::exit(1); \
+		} \
+	} while (false)
+
+/// @details Fails the test unless `expr` throws the `err` `type`
+#define XEN_TEST_THROWS(expr, type) \
+	do { \
+		bool _xen_thrown = false; \
+		try { (void)(expr); } catch (::xen::err _xen_e) { _xen_thrown = _xen_e == (type); } \
+		XEN_TEST_CHECK(_xen_thrown && #expr); \
+	} while (false)
+
+#endif /// XEN_TEST
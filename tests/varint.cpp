@@ -0,0 +1,115 @@
+/// `varint` round trips every integer type, rejects malformed input, and the bulk (SSE2) decoder agrees with the scalar one
+
+#include <limits>
+#include <vector>
+
+#include "core/varint.hpp"
+#include "tests/test.hpp"
+
+using namespace xen;
+
+static_assert(varint::encoded_len(0u) == 1 && varint::encoded_len(127u) == 1 && varint::encoded_len(128u) == 2);
+/// signed values are zigzag mapped first, 64 takes the second byte
+static_assert(varint::encoded_len(63) == 1 && varint::encoded_len(64) == 2);
+static_assert(varint::encoded_len(U64_MAX) == varint::MAX_LEN && varint::encoded_len(-1) == 1 && varint::encoded_len(-65) == 2);
+static_assert(varint::zigzag_encode(-1) == 1 && varint::zigzag_encode(1) == 2 && varint::zigzag_decode(3) == -2);
+static_assert(varint::zigzag_decode(varint::zigzag_encode(std::numeric_limits<i64_t>::min())) == std::numeric_limits<i64_t>::min());
+
+/// @details Checks `val` encodes to `encoded_len` bytes and decodes back to itself
+template <typename T_>
+static void round_trip(T_ val) {
+	u8_t buf[varint::MAX_LEN] {};
+	const u64_t len = varint::encode(val, buf);
+	XEN_TEST_CHECK(len == varint::encoded_len(val));
+
+	T_ back {};
+	XEN_TEST_CHECK(varint::decode(std::span<const u8_t>{buf, len}, back) == len && back == val);
+}
+
+/// @details Round trips the extremes of `T_` and values around every 7 bit boundary
+template <typename T_>
+static void round_trip_all() {
+	round_trip(std::numeric_limits<T_>::min());
+	round_trip(std::numeric_limits<T_>::max());
+	for (u64_t shift = 0; shift < sizeof(T_) * 8; shift += 7) {
+		const u64_t edge = u64_t{1} << shift;
+		round_trip(static_cast<T_>(edge));
+		round_trip(static_cast<T_>(edge - 1));
+		if constexpr (std::is_signed_v<T_>) round_trip(static_cast<T_>(u64_t{0} - edge));
+	}
+}
+
+/// @returns The bulk decoding of `count` values from `in`, checked against decoding them one by one
+static std::vector<u64_t> bulk(const std::vector<u8_t>& in, u64_t count) {
+	std::vector<u64_t> out(count);
+	const u64_t used = varint::decode(std::span<const u8_t>{in}, std::span<u64_t>{out});
+
+	u64_t pos = 0;
+	for (u64_t i = 0; i < count; ++i) {
+		u64_t val = 0;
+		pos += varint::decode(std::span<const u8_t>{in}.subspan(pos), val);
+		XEN_TEST_CHECK(val == out[i]);
+	}
+
+	XEN_TEST_CHECK(used == pos);
+	return out;
+}
+
+int main() {
+	round_trip_all<u8_t>();
+	round_trip_all<u16_t>();
+	round_trip_all<u32_t>();
+	round_trip_all<u64_t>();
+	round_trip_all<i8_t>();
+	round_trip_all<i16_t>();
+	round_trip_all<i32_t>();
+	round_trip_all<i64_t>();
+	round_trip(safe_u64{300});
+	round_trip(safe_i32{-300});
+
+	/// the longest valid encoding, then the same with a 10th byte past the 64th bit or continuing to an 11th
+	const u8_t max[] {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+	const u8_t wide[] {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+	const u8_t eleven[] {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+	u64_t val = 0;
+	XEN_TEST_CHECK(varint::decode(max, val) == 10 && val == U64_MAX);
+	XEN_TEST_THROWS(varint::decode(wide, val), err::NumOverflow);
+	XEN_TEST_THROWS(varint::decode(eleven, val), err::NumOverflow);
+
+	/// truncated input, a value past the target type, an output buffer too small
+	const u8_t cut[] {0x80, 0x80};
+	const u8_t three_hundred[] {0xAC, 0x02};
+	u8_t small_val = 0;
+	u8_t one[1] {};
+	XEN_TEST_THROWS(varint::decode(cut, val), err::IndexOutOfRange);
+	XEN_TEST_THROWS(varint::decode(three_hundred, small_val), err::NumOverflow);
+	XEN_TEST_THROWS(varint::encode(128, one), err::IndexOutOfRange);
+
+	/// bulk: single-byte runs (the 16 per step path), then mixed lengths, starting at every byte of a chunk
+	std::vector<u64_t> values;
+	for (u64_t i = 0; i < 100; ++i) values.push_back(i);
+	for (u64_t i = 0; i < 300; ++i) values.push_back(i % 5 == 0 ? (i * 0x9E37'79B9'7F4A'7C15ull) >> (i % 64) : i % 100);
+	values.push_back(U64_MAX);
+
+	std::vector<u8_t> encoded(values.size() * varint::MAX_LEN);
+	encoded.resize(varint::encode(std::span<const u64_t>{values}, std::span<u8_t>{encoded}));
+	XEN_TEST_CHECK(bulk(encoded, values.size()) == values);
+
+	for (u64_t skip = 1; skip < 20; ++skip) {
+		const std::vector<u8_t> tail(encoded.begin() + static_cast<i64_t>(skip), encoded.end());
+		XEN_TEST_CHECK(bulk(tail, values.size() - skip) == std::vector<u64_t>(values.begin() + static_cast<i64_t>(skip), values.end()));
+	}
+
+	/// bulk: malformed 10 & 11 byte varints inside a 16 byte chunk, and input running out
+	std::vector<u8_t> bad(20, 0x01);
+	std::vector<u64_t> out(16);
+	for (const auto& malformed : {std::vector<u8_t>(wide, wide + 10), std::vector<u8_t>(eleven, eleven + 11)}) {
+		std::vector<u8_t> in = bad;
+		in.insert(in.begin() + 2, malformed.begin(), malformed.end());
+		XEN_TEST_THROWS(varint::decode(std::span<const u8_t>{in}, std::span<u64_t>{out}), err::NumOverflow);
+	}
+
+	std::vector<u64_t> too_many(bad.size() + 1);
+	XEN_TEST_THROWS(varint::decode(std::span<const u8_t>{bad}, std::span<u64_t>{too_many}), err::IndexOutOfRange);
+	return 0;
+}